@@ -0,0 +1,84 @@
+// Measures what the virtual strategy path (StrategyManager + Strategy::selectIndex)
+// costs per request compared to the compile-time specialised path used by
+// LoadBalancerServiceT. Only selection is timed; forwarding is not involved.
+//
+// Usage: dispatch_bench [servers] [iterations]
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/strategy_manager.hpp"
+#include "strategies/round_robin.hpp"
+#include "strategies/per_worker_round_robin.hpp"
+#include "strategies/least_connections.hpp"
+#include "strategies/least_outstanding_requests.hpp"
+#include "strategies/resource_based.hpp"
+#include "strategies/join_idle_queue.hpp"
+
+static volatile size_t g_sink = 0;
+
+template <typename Fn>
+static double measureNsPerOp(size_t iterations, Fn&& fn) {
+    for (size_t i = 0; i < iterations / 10; ++i) {
+        g_sink = fn();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        g_sink = fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+template <typename StrategyT>
+static void runCase(const std::string& name,
+                    ServerSpan servers,
+                    size_t iterations) {
+    loadbalancer::Request request;
+    request.set_message("bench");
+
+    StrategyManager manager(name);
+    double dynamic_ns = measureNsPerOp(iterations, [&] {
+        auto strategy = manager.getStrategy();
+        return strategy->selectIndex(servers, request);
+    });
+
+    StrategyT strategy;
+    double specialized_ns = measureNsPerOp(iterations, [&] {
+        return strategy.StrategyT::selectIndex(servers, request);
+    });
+
+    std::cout << std::left << std::setw(28) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(14) << dynamic_ns
+              << std::setw(14) << specialized_ns
+              << std::setw(12) << (dynamic_ns - specialized_ns) << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t server_count = argc > 1 ? static_cast<size_t>(std::stoul(argv[1])) : 8;
+    size_t iterations = argc > 2 ? static_cast<size_t>(std::stoul(argv[2])) : 5000000;
+
+    std::vector<std::shared_ptr<Server>> servers;
+    for (size_t i = 0; i < server_count; ++i) {
+        auto server = std::make_shared<Server>("127.0.0.1", 50051 + static_cast<int>(i));
+        server->setCPUUsage(static_cast<double>((i * 37) % 100));
+        servers.push_back(server);
+    }
+
+    std::cout << "servers=" << server_count << " iterations=" << iterations << "\n"
+              << std::left << std::setw(28) << "strategy"
+              << std::right << std::setw(14) << "virtual ns"
+              << std::setw(14) << "special. ns"
+              << std::setw(12) << "saved ns" << std::endl;
+
+    runCase<RoundRobinStrategy>("round_robin", servers, iterations);
+    runCase<PerWorkerRoundRobinStrategy>("round_robin_per_worker", servers, iterations);
+    runCase<LeastConnectionsStrategy>("least_connections", servers, iterations);
+    runCase<LeastOutstandingRequestsStrategy>("least_outstanding_requests", servers, iterations);
+    runCase<ResourceBasedStrategy>("resource_based", servers, iterations);
+    runCase<JoinIdleQueueStrategy>("join_idle_queue", servers, iterations);
+    return 0;
+}
@@ -0,0 +1,313 @@
+// Cost of a single selection for every registered strategy across pool
+// sizes, thread counts and fractions of unhealthy servers. For each case it
+// reports ns per selection (per thread), heap allocations per selection and,
+// on Linux when perf counters are accessible, cache misses per selection.
+//
+// Usage: strategy_bench [--strategy NAME] [--max-servers N] [--max-threads N] [--ops N]
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/server.hpp"
+#include "strategies/strategy_registry.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Allocation counting: every operator new in the process bumps a per-thread
+// counter, so workers can measure their own allocations without contention.
+// ---------------------------------------------------------------------------
+static thread_local uint64_t t_allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++t_allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    ++t_allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// ---------------------------------------------------------------------------
+// Per-thread hardware cache-miss counter; reports unavailable when the kernel
+// or container does not allow perf_event_open.
+// ---------------------------------------------------------------------------
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    bool isAvailable() const { return fd_ >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t count = 0;
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+struct BenchOptions {
+    std::string strategy;  // empty = all
+    size_t max_servers = 10000;
+    size_t max_threads = 64;
+    size_t ops = 2000000;  // selections per thread for a 2-server pool
+};
+
+struct CaseResult {
+    double ns_per_op = 0.0;
+    double allocs_per_op = 0.0;
+    double misses_per_op = -1.0;  // < 0 when perf counters are unavailable
+};
+
+static volatile size_t g_sink = 0;
+
+static std::vector<std::shared_ptr<Server>> makeServers(size_t count, double unhealthy_fraction) {
+    std::vector<std::shared_ptr<Server>> servers;
+    servers.reserve(count);
+    size_t unhealthy = static_cast<size_t>(count * unhealthy_fraction);
+    for (size_t i = 0; i < count; ++i) {
+        auto server = std::make_shared<Server>("127.0.0.1", 50051 + static_cast<int>(i));
+        server->setCPUUsage(static_cast<double>((i * 37) % 100));
+        server->setMemoryUsage(static_cast<double>((i * 53) % 100));
+        // Spread the unhealthy ones out instead of bunching them at the front
+        server->setHealthStatus(unhealthy == 0 || (i * unhealthy) % count >= unhealthy);
+        servers.push_back(server);
+    }
+    return servers;
+}
+
+static CaseResult runCase(const std::string& name,
+                          const std::vector<std::shared_ptr<Server>>& servers,
+                          size_t threads,
+                          size_t ops) {
+    auto strategy = StrategyRegistry::getInstance().create(name);
+    ServerSpan span(servers);
+    loadbalancer::Request request;
+    request.set_message("bench");
+
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<double> elapsed_ns(threads, 0.0);
+    std::vector<uint64_t> allocations(threads, 0);
+    std::vector<uint64_t> misses(threads, 0);
+    std::atomic<bool> counters_available{true};
+
+    auto worker = [&](size_t index) {
+        CacheMissCounter counter;
+        if (!counter.isAvailable()) {
+            counters_available = false;
+        }
+        for (size_t i = 0; i < ops / 10 + 1; ++i) {
+            g_sink = strategy->selectIndex(span, request);
+        }
+
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        uint64_t allocs_before = t_allocations;
+        counter.start();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = strategy->selectIndex(span, request);
+        }
+        auto end = std::chrono::steady_clock::now();
+        misses[index] = counter.stop();
+        allocations[index] = t_allocations - allocs_before;
+        elapsed_ns[index] = std::chrono::duration<double, std::nano>(end - start).count();
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t t = 0; t < threads; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    go.store(true, std::memory_order_release);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    double total_ops = static_cast<double>(ops) * threads;
+    CaseResult result;
+    double total_ns = 0.0;
+    uint64_t total_allocs = 0;
+    uint64_t total_misses = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        total_ns += elapsed_ns[t];
+        total_allocs += allocations[t];
+        total_misses += misses[t];
+    }
+    result.ns_per_op = total_ns / total_ops;
+    result.allocs_per_op = total_allocs / total_ops;
+    if (counters_available) {
+        result.misses_per_op = total_misses / total_ops;
+    }
+    return result;
+}
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --strategy NAME    Only benchmark this strategy (default: all)\n"
+              << "  --max-servers N    Largest pool size (default: 10000)\n"
+              << "  --max-threads N    Largest thread count (default: 64)\n"
+              << "  --ops N            Selections per thread for the smallest pool (default: 2000000)\n";
+}
+
+static BenchOptions parseArgs(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            exit(0);
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Error: Missing value for argument " << arg << std::endl;
+            printUsage(argv[0]);
+            exit(1);
+        }
+        if (arg == "--strategy") {
+            options.strategy = argv[++i];
+        } else if (arg == "--max-servers") {
+            options.max_servers = std::stoul(argv[++i]);
+        } else if (arg == "--max-threads") {
+            options.max_threads = std::stoul(argv[++i]);
+        } else if (arg == "--ops") {
+            options.ops = std::stoul(argv[++i]);
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            printUsage(argv[0]);
+            exit(1);
+        }
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = parseArgs(argc, argv);
+
+    std::vector<std::string> strategies;
+    if (!options.strategy.empty()) {
+        if (!StrategyRegistry::getInstance().contains(options.strategy)) {
+            std::cerr << "Unknown strategy: " << options.strategy << std::endl;
+            return 1;
+        }
+        strategies.push_back(options.strategy);
+    } else {
+        for (const auto& name : StrategyRegistry::getInstance().getNames()) {
+            // Decorators are listed as "<name>:<strategy>"; bench them over round robin
+            size_t placeholder = name.find("<strategy>");
+            strategies.push_back(placeholder == std::string::npos
+                ? name
+                : name.substr(0, placeholder) + "round_robin");
+        }
+    }
+
+    const size_t server_counts[] = {2, 8, 64, 1000, 10000};
+    const size_t thread_counts[] = {1, 2, 4, 8, 16, 32, 64};
+    const double unhealthy_fractions[] = {0.0, 0.1, 0.5};
+
+    std::cout << "hardware threads=" << std::thread::hardware_concurrency() << "\n"
+              << std::left << std::setw(40) << "strategy"
+              << std::right << std::setw(8) << "servers"
+              << std::setw(8) << "threads"
+              << std::setw(10) << "unhealthy"
+              << std::setw(12) << "ns/op"
+              << std::setw(12) << "allocs/op"
+              << std::setw(12) << "misses/op" << std::endl;
+
+    for (size_t server_count : server_counts) {
+        if (server_count > options.max_servers) continue;
+        // Keep the per-case run time roughly flat for O(n) strategies
+        size_t ops = std::max<size_t>(1000, options.ops * 2 / server_count);
+        for (double unhealthy : unhealthy_fractions) {
+            auto servers = makeServers(server_count, unhealthy);
+            for (size_t threads : thread_counts) {
+                if (threads > options.max_threads) continue;
+                for (const auto& name : strategies) {
+                    auto result = runCase(name, servers, threads, ops);
+                    std::cout << std::left << std::setw(40) << name
+                              << std::right << std::setw(8) << server_count
+                              << std::setw(8) << threads
+                              << std::setw(10) << std::fixed << std::setprecision(2) << unhealthy
+                              << std::setw(12) << result.ns_per_op
+                              << std::setw(12) << std::setprecision(3) << result.allocs_per_op;
+                    if (result.misses_per_op >= 0.0) {
+                        std::cout << std::setw(12) << std::setprecision(2) << result.misses_per_op;
+                    } else {
+                        std::cout << std::setw(12) << "n/a";
+                    }
+                    std::cout << std::endl;
+                }
+            }
+        }
+    }
+    return 0;
+}
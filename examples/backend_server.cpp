@@ -1,61 +1,240 @@
-#include <iostream>
-#include <string>
-#include <grpcpp/grpcpp.h>
-#include <core/process/process_factory.hpp>
-#include "proto/load_balancer.grpc.pb.h"
-#include "proto/admin_service.grpc.pb.h"
-
-class BackendServer final : public loadbalancer::LoadBalancerService::Service, public admin::AdminService::Service{
-public:
-    grpc::Status HandleRequest(grpc::ServerContext *context, const loadbalancer::Request *request, loadbalancer::Response *response) override {
-        std::cout << "Backend server received request: " << request->message()
-                  << " on port: " << port_ << std::endl;
-
-        response->set_message("Response from backend server on port: " +
-                              std::to_string(port_));
-        response->set_server_id("backend_" + std::to_string(port_));
-
-        return grpc::Status::OK;
-    }
-
-    grpc::Status GetMetrics(grpc::ServerContext *context, const google::protobuf::Empty *request, admin::MetricsResponse *response) override {
-        auto process = ProcessFactory::createProcess();
-        double cpu = process->getCPUUsage();
-        double mem = process->getMemoryUsage();
-        response->set_cpu_usage(cpu);
-        response->set_memory_usage(mem);
-        return grpc::Status::OK;
-    }
-
-    void setPort(int port) { port_ = port; }
-
-private:
-    int port_;
-};
-
-int main(int argc, char **argv)
-{
-    if (argc != 2){
-        std::cerr << "Usage: " << argv[0] << " <port>" << std::endl;
-        return 1;
-    }
-
-    const int port = std::stoi(argv[1]);
-    const std::string server_address = "0.0.0.0:" + std::to_string(port);
-
-    BackendServer service;
-    service.setPort(port);
-
-    grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-    
-    builder.RegisterService(static_cast<loadbalancer::LoadBalancerService::Service*>(&service));
-    builder.RegisterService(static_cast<admin::AdminService::Service*>(&service));
-
-    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-    std::cout << "Backend server listening on port: " << port << std::endl;
-
-    server->Wait();
-
-    return 0;
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <csignal>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <grpcpp/grpcpp.h>
+#include <core/heartbeat.hpp>
+#include <core/process/process_factory.hpp>
+#include "proto/load_balancer.grpc.pb.h"
+#include "proto/admin_service.grpc.pb.h"
+#include "proto/health.grpc.pb.h"
+
+using grpc::health::v1::HealthCheckRequest;
+using grpc::health::v1::HealthCheckResponse;
+
+class BackendServer final : public loadbalancer::LoadBalancerService::Service, public admin::AdminService::Service{
+public:
+    grpc::Status HandleRequest(grpc::ServerContext *context, const loadbalancer::Request *request, loadbalancer::Response *response) override {
+        InFlightRequest tracker(*this);
+
+        std::cout << "Backend server received request: " << request->message()
+                  << " on port: " << port_ << std::endl;
+
+        response->set_message("Response from backend server on port: " +
+                              std::to_string(port_));
+        response->set_server_id("backend_" + std::to_string(port_));
+
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetMetrics(grpc::ServerContext *context, const google::protobuf::Empty *request, admin::MetricsResponse *response) override {
+        double cpu = self_process_->getCPUUsage();
+        double mem = self_process_->getMemoryUsage();
+        response->set_cpu_usage(cpu);
+        response->set_memory_usage(mem);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status ProbeLoad(grpc::ServerContext *context, const google::protobuf::Empty *request, admin::ProbeLoadResponse *response) override {
+        response->set_in_flight(static_cast<uint32_t>(in_flight_.load()));
+        std::lock_guard<std::mutex> lock(latency_mutex_);
+        response->set_latency_estimate_ms(latency_estimate_ms_);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status StreamMetrics(grpc::ServerContext *context, const admin::StreamMetricsRequest *request, grpc::ServerWriter<admin::MetricsSample> *writer) override {
+        auto interval = std::chrono::milliseconds(std::max(request->interval_ms(), MIN_STREAM_INTERVAL_MS));
+        auto max_silence = std::chrono::milliseconds(request->max_silence_ms());
+
+        admin::MetricsSample last_sent;
+        auto last_sent_time = std::chrono::steady_clock::now();
+        bool first = true;
+        while (!context->IsCancelled()) {
+            admin::MetricsSample sample;
+            sample.set_cpu_usage(self_process_->getCPUUsage());
+            sample.set_memory_usage(self_process_->getMemoryUsage());
+            int in_flight = in_flight_.load();
+            sample.set_in_flight(static_cast<uint32_t>(in_flight));
+            sample.set_queue_depth(queueDepth(in_flight));
+
+            auto now = std::chrono::steady_clock::now();
+            bool keepalive_due = max_silence.count() > 0 && now - last_sent_time >= max_silence;
+            if (first || keepalive_due || hasChanged(last_sent, sample, request->min_change())) {
+                if (!writer->Write(sample)) {
+                    break;
+                }
+                last_sent = sample;
+                last_sent_time = now;
+                first = false;
+            }
+            std::this_thread::sleep_for(interval);
+        }
+        return grpc::Status::OK;
+    }
+
+    void setPort(int port) { port_ = port; }
+    void setHeartbeat(HeartbeatPublisher* heartbeat) { heartbeat_ = heartbeat; }
+
+private:
+    // Counts a request as in flight and folds its duration into the latency estimate
+    class InFlightRequest {
+    public:
+        explicit InFlightRequest(BackendServer& server)
+            : server_(server), start_(std::chrono::steady_clock::now()) {
+            server_.publishLoad(++server_.in_flight_);
+        }
+        ~InFlightRequest() {
+            server_.publishLoad(--server_.in_flight_);
+            if (server_.heartbeat_) {
+                server_.heartbeat_->requestCompleted();
+            }
+            double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+            std::lock_guard<std::mutex> lock(server_.latency_mutex_);
+            server_.latency_estimate_ms_ += LATENCY_SMOOTHING * (elapsed_ms - server_.latency_estimate_ms_);
+        }
+
+    private:
+        BackendServer& server_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    // Requests beyond one per core have to wait for one
+    static uint32_t queueDepth(int in_flight) {
+        int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return static_cast<uint32_t>(std::max(0, in_flight - cores));
+    }
+
+    void publishLoad(int in_flight) {
+        if (heartbeat_) {
+            heartbeat_->setLoad(static_cast<uint32_t>(std::max(0, in_flight)), queueDepth(in_flight));
+        }
+    }
+
+    // Counts must move by at least one request and by 10% to be worth sending
+    static bool hasChanged(const admin::MetricsSample& last, const admin::MetricsSample& sample, double min_change) {
+        auto count_changed = [](uint32_t before, uint32_t after) {
+            uint32_t delta = before > after ? before - after : after - before;
+            return delta > 0 && delta * 10 >= before;
+        };
+        return std::abs(sample.cpu_usage() - last.cpu_usage()) >= min_change
+            || std::abs(sample.memory_usage() - last.memory_usage()) >= min_change
+            || count_changed(last.in_flight(), sample.in_flight())
+            || count_changed(last.queue_depth(), sample.queue_depth());
+    }
+
+    static constexpr double LATENCY_SMOOTHING = 0.1;
+    static constexpr uint32_t MIN_STREAM_INTERVAL_MS = 10;
+
+    int port_;
+    std::atomic<int> in_flight_{0};
+    HeartbeatPublisher* heartbeat_ = nullptr;
+    // Never started, so it reports on this backend; sampled in the background
+    std::unique_ptr<Process> self_process_ = ProcessFactory::createProcess();
+    std::mutex latency_mutex_;
+    double latency_estimate_ms_ = 0.0;
+};
+
+// Standard grpc.health.v1 service for the whole server (service ""). Watch
+// streams get the current status at once and every change after that.
+class HealthService final : public grpc::health::v1::Health::Service {
+public:
+    grpc::Status Check(grpc::ServerContext *context, const HealthCheckRequest *request, HealthCheckResponse *response) override {
+        if (!request->service().empty()) {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "unknown service");
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        response->set_status(status_);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status Watch(grpc::ServerContext *context, const HealthCheckRequest *request, grpc::ServerWriter<HealthCheckResponse> *writer) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        bool first = true;
+        HealthCheckResponse::ServingStatus last_sent = HealthCheckResponse::UNKNOWN;
+        while (!context->IsCancelled()) {
+            auto status = request->service().empty() ? status_ : HealthCheckResponse::SERVICE_UNKNOWN;
+            if (first || status != last_sent) {
+                HealthCheckResponse response;
+                response.set_status(status);
+                lock.unlock();
+                bool written = writer->Write(response);
+                lock.lock();
+                if (!written) {
+                    break;
+                }
+                last_sent = status;
+                first = false;
+            }
+            // Wakes up now and then to notice cancelled watches
+            changed_.wait_for(lock, WATCH_CANCEL_POLL);
+        }
+        return grpc::Status::OK;
+    }
+
+    void setServing(bool serving) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = serving ? HealthCheckResponse::SERVING : HealthCheckResponse::NOT_SERVING;
+        changed_.notify_all();
+    }
+
+private:
+    static constexpr std::chrono::milliseconds WATCH_CANCEL_POLL{200};
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    HealthCheckResponse::ServingStatus status_ = HealthCheckResponse::SERVING;
+};
+
+static std::atomic<bool> stop_requested{false};
+
+static void onStopSignal(int) {
+    stop_requested = true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2){
+        std::cerr << "Usage: " << argv[0] << " <port>" << std::endl;
+        return 1;
+    }
+
+    const int port = std::stoi(argv[1]);
+    const std::string server_address = "0.0.0.0:" + std::to_string(port);
+
+    // Present when spawned by a load balancer on this host
+    auto heartbeat = HeartbeatPublisher::fromEnvironment();
+
+    BackendServer service;
+    service.setPort(port);
+    service.setHeartbeat(heartbeat.get());
+    HealthService health;
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    
+    builder.RegisterService(static_cast<loadbalancer::LoadBalancerService::Service*>(&service));
+    builder.RegisterService(static_cast<admin::AdminService::Service*>(&service));
+    builder.RegisterService(&health);
+
+    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    std::cout << "Backend server listening on port: " << port << std::endl;
+
+    std::signal(SIGTERM, onStopSignal);
+    std::signal(SIGINT, onStopSignal);
+    while (!stop_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    // Tell health watchers first, then give in-flight calls a moment to finish
+    health.setServing(false);
+    server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+    heartbeat.reset();
+
+    return 0;
 }
\ No newline at end of file
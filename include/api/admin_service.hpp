@@ -1,37 +1,56 @@
-#pragma once
-
-#include "admin_service.grpc.pb.h"
-#include "core/server_manager.hpp"
-#include <memory>
-
-class AdminService final : public admin::AdminService::Service {
-public:
-    explicit AdminService(std::shared_ptr<ServerManager> server_manager);
-
-    // List all servers
-    ::grpc::Status ListServers(::grpc::ServerContext* context,
-                               const ::google::protobuf::Empty* request,
-                               admin::ListServersResponse* response) override;
-
-    // Update the health of a server
-    ::grpc::Status UpdateServerHealth(::grpc::ServerContext* context,
-                                      const admin::UpdateServerHealthRequests* request,
-                                      ::google::protobuf::Empty* response) override;
-
-    // Add a new server
-    ::grpc::Status AddServer(::grpc::ServerContext* context,
-                             const ::google::protobuf::Empty* request,
-                             admin::AddServerResponse* response) override;
-
-    // Remove a server
-    ::grpc::Status RemoveServer(::grpc::ServerContext* context,
-                                const admin::RemoveServerRequest* request,
-                                ::google::protobuf::Empty* response) override;
-    
-    // Get server stats
-    ::grpc::Status GetServerConstraints(::grpc::ServerContext* context,
-                                  const ::google::protobuf::Empty* request,
-                                  admin::ServerConstraintsResponse* response) override;
-private:
-    std::shared_ptr<ServerManager> server_manager_;
-};
+#pragma once
+
+#include "admin_service.grpc.pb.h"
+#include "core/server_manager.hpp"
+#include "core/strategy_manager.hpp"
+#include <memory>
+#include <vector>
+
+class AdminService final : public admin::AdminService::Service {
+public:
+    AdminService(std::shared_ptr<ServerManager> server_manager,
+                 std::shared_ptr<StrategyManager> strategy_manager);
+
+    // List all servers
+    ::grpc::Status ListServers(::grpc::ServerContext* context,
+                               const ::google::protobuf::Empty* request,
+                               admin::ListServersResponse* response) override;
+
+    // Update the health of a server
+    ::grpc::Status UpdateServerHealth(::grpc::ServerContext* context,
+                                      const admin::UpdateServerHealthRequests* request,
+                                      ::google::protobuf::Empty* response) override;
+
+    // Add a new server
+    ::grpc::Status AddServer(::grpc::ServerContext* context,
+                             const ::google::protobuf::Empty* request,
+                             admin::AddServerResponse* response) override;
+
+    // Remove a server
+    ::grpc::Status RemoveServer(::grpc::ServerContext* context,
+                                const admin::RemoveServerRequest* request,
+                                ::google::protobuf::Empty* response) override;
+    
+    // Get server stats
+    ::grpc::Status GetServerConstraints(::grpc::ServerContext* context,
+                                  const ::google::protobuf::Empty* request,
+                                  admin::ServerConstraintsResponse* response) override;
+
+    // Mark a server as draining
+    ::grpc::Status SetServerDraining(::grpc::ServerContext* context,
+                                     const admin::SetServerDrainingRequest* request,
+                                     ::google::protobuf::Empty* response) override;
+
+    // Swap the load balancing strategy at runtime
+    ::grpc::Status SetStrategy(::grpc::ServerContext* context,
+                               const admin::SetStrategyRequest* request,
+                               admin::StrategyResponse* response) override;
+
+    // Batch as ServerManager applies it: only the fields set in a delta
+    // (base_version != 0), every field otherwise
+    static std::vector<HealthUpdate> toHealthUpdates(const admin::UpdateServerHealthRequests& request);
+
+private:
+    std::shared_ptr<ServerManager> server_manager_;
+    std::shared_ptr<StrategyManager> strategy_manager_;
+};
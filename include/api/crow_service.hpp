@@ -1,8 +1,10 @@
-#pragma once
-
-#include "crow.h"
-#include "nlohmann/json.hpp"
-#include "core/server_manager.hpp"
-#include <iostream>
-
-void runCrowServer(std::shared_ptr<ServerManager> server_manager);
\ No newline at end of file
+#pragma once
+
+#include "crow.h"
+#include "nlohmann/json.hpp"
+#include "core/server_manager.hpp"
+#include "core/strategy_manager.hpp"
+#include <iostream>
+
+void runCrowServer(std::shared_ptr<ServerManager> server_manager,
+                   std::shared_ptr<StrategyManager> strategy_manager);
\ No newline at end of file
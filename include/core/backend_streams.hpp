@@ -0,0 +1,266 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/client_callback.h>
+#include "core/server.hpp"
+
+// Keeps one server-streaming call open per backend and hands every message
+// it receives to a handler. Calls that end are reopened in the background,
+// backing off exponentially while they keep failing; a backend that answers
+// UNIMPLEMENTED is not asked again. What a failed call means for the server
+// is up to the failure handler.
+//
+// Rpc describes the call:
+//   using Stub = ...;  using Request = ...;  using Response = ...;
+//   static const char* name();  // for log messages
+//   static std::unique_ptr<Stub> newStub(const std::shared_ptr<grpc::Channel>& channel);
+//   static void start(Stub& stub, grpc::ClientContext* context, const Request* request,
+//                     grpc::ClientReadReactor<Response>* reactor);
+template <typename Rpc>
+class BackendStreams {
+public:
+    using Request = typename Rpc::Request;
+    using Response = typename Rpc::Response;
+
+    struct Options {
+        std::chrono::milliseconds initial_backoff{500};
+        std::chrono::milliseconds max_backoff{30000};
+    };
+    // Both are called from gRPC threads without any BackendStreams lock held
+    struct Handlers {
+        std::function<void(Server& server, const Response& response)> on_message;
+        // A call ended with an error. failures counts the calls in a row that
+        // ended without delivering a message, plus this one if it did.
+        std::function<void(Server& server, const grpc::Status& status, int failures)> on_failure;
+    };
+
+    BackendStreams(const Options& options, Request request, Handlers handlers)
+        : options_(options)
+        , request_(std::move(request))
+        , handlers_(std::move(handlers))
+        , reconnect_thread_(&BackendStreams::reconnectLoop, this) {}
+
+    // Cancels every call and waits for them to finish
+    ~BackendStreams() {
+        std::unordered_map<std::string, Entry> entries;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            entries.swap(entries_);
+        }
+        cv_.notify_all();
+        reconnect_thread_.join();
+        for (auto& entry : entries) {
+            entry.second.stream->cancel();
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return live_streams_ == 0; });
+    }
+
+    BackendStreams(const BackendStreams&) = delete;
+    BackendStreams& operator=(const BackendStreams&) = delete;
+
+    void watch(const std::shared_ptr<Server>& server) {
+        std::shared_ptr<Stream> stream;
+        std::shared_ptr<Stream> previous;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) {
+                return;
+            }
+            // A freshly spawned backend may not be listening yet
+            stream = createStream(server, true);
+            Entry& entry = entries_[server->getId()];
+            previous = std::move(entry.stream);
+            entry = Entry();
+            entry.stream = stream;
+        }
+        if (previous) {
+            previous->cancel();
+        }
+        stream->start(stream);
+    }
+
+    void unwatch(const std::string& id) {
+        std::shared_ptr<Stream> stream;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries_.find(id);
+            if (it == entries_.end()) {
+                return;
+            }
+            stream = std::move(it->second.stream);
+            entries_.erase(it);
+        }
+        stream->cancel();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // One call. Keeps itself alive until gRPC reports it done.
+    class Stream : public grpc::ClientReadReactor<Response> {
+    public:
+        Stream(BackendStreams& owner, const std::shared_ptr<Server>& server, bool wait_for_ready)
+            : owner_(owner)
+            , server_(server)
+            , id_(server->getId())
+            , stub_(Rpc::newStub(server->getChannel())) {
+            context_.set_wait_for_ready(wait_for_ready);
+        }
+
+        void start(std::shared_ptr<Stream> self) {
+            self_ = std::move(self);
+            Rpc::start(*stub_, &context_, &owner_.request_, this);
+            this->StartRead(&response_);
+            this->StartCall();
+        }
+
+        void cancel() { context_.TryCancel(); }
+
+        const std::string& getId() const { return id_; }
+        std::shared_ptr<Server> getServer() const { return server_.lock(); }
+        bool hasReceived() const { return received_.load(std::memory_order_relaxed); }
+
+        void OnReadDone(bool ok) override {
+            if (!ok) {
+                return;  // OnDone follows
+            }
+            received_.store(true, std::memory_order_relaxed);
+            if (auto server = server_.lock()) {
+                owner_.handlers_.on_message(*server, response_);
+            }
+            this->StartRead(&response_);
+        }
+
+        void OnDone(const grpc::Status& status) override {
+            // Released on return, after the owner has been notified
+            auto self = std::move(self_);
+            owner_.onStreamDone(*this, status);
+        }
+
+    private:
+        BackendStreams& owner_;
+        std::weak_ptr<Server> server_;
+        std::string id_;
+        std::unique_ptr<typename Rpc::Stub> stub_;
+        grpc::ClientContext context_;
+        Response response_;
+        std::shared_ptr<Stream> self_;
+        std::atomic<bool> received_{false};
+    };
+
+    struct Entry {
+        std::shared_ptr<Stream> stream;
+        bool finished = false;
+        bool unimplemented = false;
+        int failures = 0;
+        Clock::time_point retry_at;
+    };
+
+    // mutex_ must be held. The caller starts the stream after releasing it.
+    std::shared_ptr<Stream> createStream(const std::shared_ptr<Server>& server, bool wait_for_ready) {
+        live_streams_++;
+        return std::make_shared<Stream>(*this, server, wait_for_ready);
+    }
+
+    void onStreamDone(Stream& stream, const grpc::Status& status) {
+        int failures = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // Nothing to retry if it was unwatched (or watched anew) meanwhile
+            auto it = entries_.find(stream.getId());
+            if (it != entries_.end() && it->second.stream.get() == &stream) {
+                Entry& entry = it->second;
+                entry.finished = true;
+                entry.unimplemented = status.error_code() == grpc::StatusCode::UNIMPLEMENTED;
+                entry.failures = stream.hasReceived() ? 1 : entry.failures + 1;
+                auto backoff = options_.initial_backoff * (int64_t{1} << std::min(entry.failures - 1, 16));
+                entry.retry_at = Clock::now() + std::min<Clock::duration>(backoff, options_.max_backoff);
+                failures = entry.failures;
+            }
+        }
+
+        auto server = stream.getServer();
+        if (failures > 0 && server && !status.ok()) {
+            std::cerr << Rpc::name() << " on " << server->getId() << " ended: " << status.error_message() << std::endl;
+            if (status.error_code() != grpc::StatusCode::UNIMPLEMENTED) {
+                handlers_.on_failure(*server, status, failures);
+            }
+        }
+
+        // Notify under the lock: the destructor may be waiting to return
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_streams_--;
+        cv_.notify_all();
+    }
+
+    void reconnectLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            auto now = Clock::now();
+            auto next_retry = Clock::time_point::max();
+            std::vector<std::shared_ptr<Stream>> restarted;
+            for (auto it = entries_.begin(); it != entries_.end();) {
+                Entry& entry = it->second;
+                if (!entry.finished || entry.unimplemented) {
+                    ++it;
+                    continue;
+                }
+                auto server = entry.stream->getServer();
+                if (!server) {
+                    it = entries_.erase(it);
+                    continue;
+                }
+                if (now < entry.retry_at) {
+                    next_retry = std::min(next_retry, entry.retry_at);
+                    ++it;
+                    continue;
+                }
+                // Fail fast: a backend that doesn't take the call now counts
+                // as a failed reconnect rather than leaving it pending
+                entry.stream = createStream(server, false);
+                entry.finished = false;
+                restarted.push_back(entry.stream);
+                ++it;
+            }
+
+            if (!restarted.empty()) {
+                lock.unlock();
+                for (auto& stream : restarted) {
+                    stream->start(stream);
+                }
+                lock.lock();
+                continue;
+            }
+            // Woken early by finishing streams and by the destructor
+            if (next_retry == Clock::time_point::max()) {
+                cv_.wait(lock);
+            } else {
+                cv_.wait_until(lock, next_retry);
+            }
+        }
+    }
+
+    Options options_;
+    Request request_;
+    Handlers handlers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::unordered_map<std::string, Entry> entries_;
+    size_t live_streams_ = 0;  // started streams that haven't finished yet
+    std::thread reconnect_thread_;
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// Adaptive per-backend concurrency limit (gradient style). The limit follows
+// the ratio between the long-term RTT and the latest RTT sample: while
+// latency stays near its baseline the limit grows, when requests start
+// queueing inside the backend the RTT rises and the limit shrinks. Requests
+// beyond the limit are rejected by tryAcquire() or wait in a small bounded
+// queue in acquire().
+class ConcurrencyLimiter {
+public:
+    struct Options {
+        int initial_limit = 20;
+        int min_limit = 1;
+        int max_limit = 1000;
+        double smoothing = 0.2;
+        double rtt_tolerance = 1.5;
+        int long_window = 600;
+        size_t max_queue = 16;
+        std::chrono::milliseconds queue_timeout{100};
+    };
+
+    enum class Outcome {
+        Success,  // RTT is a valid sample
+        Dropped,  // backend overloaded / unavailable: back off
+        Ignored   // cancelled, timed out on the caller's deadline, or
+                  // failed for reasons unrelated to load
+    };
+
+    // Held for the duration of one backend call; returns the slot and feeds
+    // the measured RTT back into the limit when destroyed.
+    class Permit {
+    public:
+        Permit() = default;
+        Permit(Permit&& other) noexcept;
+        Permit& operator=(Permit&& other) noexcept;
+        ~Permit();
+
+        Permit(const Permit&) = delete;
+        Permit& operator=(const Permit&) = delete;
+
+        explicit operator bool() const { return limiter_ != nullptr; }
+        void setOutcome(Outcome outcome) { outcome_ = outcome; }
+
+    private:
+        friend class ConcurrencyLimiter;
+        Permit(ConcurrencyLimiter* limiter, int in_flight);
+
+        ConcurrencyLimiter* limiter_ = nullptr;
+        int in_flight_at_start_ = 0;
+        std::chrono::steady_clock::time_point start_;
+        Outcome outcome_ = Outcome::Ignored;
+    };
+
+    ConcurrencyLimiter();
+    explicit ConcurrencyLimiter(const Options& options);
+
+    Permit tryAcquire();
+    // Waits up to options.queue_timeout for a slot if the queue has room.
+    Permit acquire();
+
+    int getLimit() const { return limit_.load(std::memory_order_relaxed); }
+    int getInFlight() const { return in_flight_.load(std::memory_order_relaxed); }
+    size_t getQueued() const { return queued_.load(std::memory_order_relaxed); }
+    bool isAtLimit() const { return getInFlight() >= getLimit(); }
+
+private:
+    bool tryIncrement(int& in_flight);
+    void release(std::chrono::nanoseconds rtt, int in_flight_at_start, Outcome outcome);
+
+    Options options_;
+    std::atomic<int> limit_;
+    std::atomic<int> in_flight_{0};
+    std::atomic<size_t> queued_{0};
+
+    std::mutex mutex_;
+    std::condition_variable slot_available_;
+    double estimated_limit_;
+    double long_rtt_ns_ = 0.0;
+};
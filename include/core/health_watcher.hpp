@@ -0,0 +1,40 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include "core/server.hpp"
+
+template <typename Rpc>
+class BackendStreams;
+struct HealthWatchRpc;
+
+// Keeps one grpc.health.v1.Health/Watch stream open per backend and reports
+// every serving-status transition as it happens. A stream that breaks is
+// reopened with backoff, and the server is only reported as not serving
+// once the reconnects fail too, so a transient Watch failure doesn't take
+// a live backend out. Backends that don't implement the health service are
+// left to the health checker.
+class HealthWatcher {
+public:
+    struct Options {
+        bool enabled = true;
+    };
+    // Called from gRPC threads without any HealthWatcher lock held
+    using Callback = std::function<void(Server& server, bool serving)>;
+
+    HealthWatcher(const Options& options, Callback on_change);
+    // Cancels every stream and waits for them to finish
+    ~HealthWatcher();
+
+    HealthWatcher(const HealthWatcher&) = delete;
+    HealthWatcher& operator=(const HealthWatcher&) = delete;
+
+    bool isEnabled() const { return streams_ != nullptr; }
+
+    void watch(const std::shared_ptr<Server>& server);
+    void unwatch(const std::string& id);
+
+private:
+    Callback on_change_;
+    std::unique_ptr<BackendStreams<HealthWatchRpc>> streams_;
+};
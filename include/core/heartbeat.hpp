@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Environment variable carrying the fd of a backend's heartbeat page
+inline constexpr char HEARTBEAT_FD_ENV[] = "LB_HEARTBEAT_FD";
+
+// Page a co-located backend shares with the load balancer: a memfd the LB
+// creates per backend and the backend inherits at spawn. Both sides only
+// do plain atomic loads and stores on it.
+struct HeartbeatPage {
+    static constexpr uint32_t MAGIC = 0x4C424842;  // "LBHB"
+
+    std::atomic<uint32_t> magic;        // MAGIC while the backend is attached
+    std::atomic<uint32_t> interval_ms;  // beat period, set by the LB
+    std::atomic<uint64_t> beats;        // bumped by the backend every interval_ms
+    std::atomic<uint64_t> completed;    // requests finished so far
+    std::atomic<uint32_t> in_flight;
+    std::atomic<uint32_t> queue_depth;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "heartbeat counters are shared between processes and must be lock-free");
+
+// Backend side. Maps the page named by LB_HEARTBEAT_FD and beats from its
+// own thread, so a backend that hangs or is stopped goes quiet even if its
+// sockets stay open. The request path updates the load counters.
+class HeartbeatPublisher {
+public:
+    // Null when the backend wasn't started with a heartbeat page
+    static std::unique_ptr<HeartbeatPublisher> fromEnvironment();
+    // Detaches, which the LB sees as the backend going away on purpose
+    ~HeartbeatPublisher();
+
+    HeartbeatPublisher(const HeartbeatPublisher&) = delete;
+    HeartbeatPublisher& operator=(const HeartbeatPublisher&) = delete;
+
+    void setLoad(uint32_t in_flight, uint32_t queue_depth) {
+        page_->in_flight.store(in_flight, std::memory_order_relaxed);
+        page_->queue_depth.store(queue_depth, std::memory_order_relaxed);
+    }
+    void requestCompleted() { page_->completed.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    explicit HeartbeatPublisher(HeartbeatPage* page);
+    void run();
+
+    HeartbeatPage* page_;
+    std::mutex mutex_;
+    std::condition_variable stop_cv_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
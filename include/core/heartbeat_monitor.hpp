@@ -0,0 +1,77 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "core/heartbeat.hpp"
+#include "core/server.hpp"
+
+// Liveness of co-located backends through shared-memory heartbeat pages.
+// One thread wakes every beat interval and does a few plain loads per
+// backend. A backend is reported as not serving when its beat counter stops
+// moving for stall_timeout (hung, stopped or dead), when it has requests in
+// flight but completes none for wedge_timeout, or when it detaches; it is
+// reported serving again once it recovers. The load counters on the page
+// are copied into the Server as they change. Linux only; elsewhere
+// createPage() returns -1 and nothing is watched.
+class HeartbeatMonitor {
+public:
+    struct Options {
+        bool enabled = true;
+        std::chrono::milliseconds beat_interval{10};
+        // Generous next to the beat interval: a backend throttled by its
+        // cgroup's cpu.max, or briefly descheduled, shouldn't look hung
+        std::chrono::milliseconds stall_timeout{1000};
+        std::chrono::milliseconds wedge_timeout{5000};
+    };
+    // Called from the monitor thread without any HeartbeatMonitor lock held
+    using Callback = std::function<void(Server& server, bool serving)>;
+
+    HeartbeatMonitor(const Options& options, Callback on_change);
+    ~HeartbeatMonitor();
+
+    HeartbeatMonitor(const HeartbeatMonitor&) = delete;
+    HeartbeatMonitor& operator=(const HeartbeatMonitor&) = delete;
+
+    bool isEnabled() const { return options_.enabled; }
+
+    // Creates the page for a backend about to be spawned and returns the fd
+    // its process should inherit, or -1
+    int createPage(const std::string& id);
+    // Starts checking the page once the backend has been spawned
+    void watch(const std::shared_ptr<Server>& server);
+    // Forgets the backend and releases its page (also after a failed spawn)
+    void unwatch(const std::string& id);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        HeartbeatPage* page = nullptr;
+        int fd = -1;  // kept until the backend has been spawned
+        std::weak_ptr<Server> server;
+        bool attached = false;  // the backend has mapped the page
+        bool serving = true;    // as last reported
+        uint64_t last_beats = 0;
+        Clock::time_point last_beat_time;
+        uint64_t last_completed = 0;
+        Clock::time_point last_progress_time;
+    };
+
+    static void release(Entry& entry);
+    // Updates the entry; true if the backend looks alive
+    bool check(Entry& entry, Server& server, Clock::time_point now);
+    void run();
+
+    Options options_;
+    Callback on_change_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::unordered_map<std::string, Entry> entries_;
+    std::thread thread_;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Exponentially decayed estimate of a server's successful call latency,
+// kept in log space (log milliseconds) since RTTs are roughly log-normal.
+// Updates are serialised; reads are lock-free and may mix fields from two
+// consecutive updates, which is fine for routing.
+//
+// The weight is the effective number of samples behind the estimate. It is
+// capped by the per-sample smoothing and also decays while the server gets
+// no traffic, so estimates for servers that are not being picked grow
+// uncertain again over time.
+class LatencyTracker {
+public:
+    struct Estimate {
+        double mean = 0.0;      // of log(latency in ms)
+        double variance = 0.0;
+        double weight = 0.0;    // effective sample count, 0 if never measured
+    };
+
+    void record(std::chrono::microseconds latency);
+    Estimate getEstimate() const;
+
+private:
+    static constexpr double kSmoothing = 0.05;
+    static constexpr double kIdleHalfLifeSeconds = 10.0;
+    static constexpr double kMinVariance = 0.01;
+
+    std::mutex mutex_;
+    std::atomic<double> mean_{0.0};
+    std::atomic<double> variance_{0.0};
+    std::atomic<double> weight_{0.0};
+    std::atomic<int64_t> last_update_ns_{0};
+};
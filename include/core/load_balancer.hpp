@@ -1,21 +1,121 @@
-#pragma once
-#include <memory>
-#include <grpcpp/grpcpp.h>
-#include "proto/load_balancer.grpc.pb.h"
-#include "core/server_manager.hpp"
-#include "strategies/strategy.hpp"
-
-class LoadBalancerService final : public loadbalancer::LoadBalancerService::Service {
-public:
-    LoadBalancerService(std::shared_ptr<ServerManager> server_manager,
-                       std::shared_ptr<Strategy> strategy);
-
-    grpc::Status HandleRequest(
-        grpc::ServerContext* context,
-        const loadbalancer::Request* request,
-        loadbalancer::Response* response) override;
-
-private:
-    std::shared_ptr<ServerManager> server_manager_;
-    std::shared_ptr<Strategy> strategy_;
-};
\ No newline at end of file
+#pragma once
+#include <chrono>
+#include <memory>
+#include <string>
+#include <grpcpp/grpcpp.h>
+#include "proto/load_balancer.grpc.pb.h"
+#include "core/server_manager.hpp"
+#include "core/strategy_manager.hpp"
+#include "strategies/round_robin.hpp"
+#include "strategies/per_worker_round_robin.hpp"
+#include "strategies/least_connections.hpp"
+#include "strategies/least_outstanding_requests.hpp"
+#include "strategies/resource_based.hpp"
+#include "strategies/join_idle_queue.hpp"
+
+// Request path shared by the runtime-configurable service and the
+// compile-time specialised ones. The selection step is passed in as a
+// callable so each service can inline its own, as is the completion hook
+// handed back to the strategy; selection gets a span over the
+// current ServerSnapshot and returns an index, so selecting a server takes
+// no heap allocations and no per-server reference counting.
+class LoadBalancerServiceBase : public loadbalancer::LoadBalancerService::Service {
+protected:
+    explicit LoadBalancerServiceBase(std::shared_ptr<ServerManager> server_manager);
+
+    template <typename SelectFn, typename FinishFn>
+    grpc::Status dispatch(grpc::ServerContext* context,
+                          const loadbalancer::Request* request,
+                          loadbalancer::Response* response,
+                          SelectFn&& select,
+                          FinishFn&& finished) {
+        // Keeps every server in the span alive until the call completes
+        auto snapshot = server_manager_->getSnapshot();
+        ServerSpan servers(snapshot->servers);
+        size_t index = select(servers);
+        if (index == Strategy::npos) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "No servers available");
+        }
+
+        Server* selected_server = servers[index].get();
+        auto permit = admit(servers, selected_server);
+        if (!permit) {
+            return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                "All servers are at their concurrency limit");
+        }
+        std::chrono::microseconds latency{0};
+        auto status = forward(context, *selected_server, permit, request, response, latency);
+        finished(*selected_server, latency, status.ok());
+        return status;
+    }
+
+    // Takes a concurrency slot on the selected server. If it is at its limit
+    // the request is rerouted to any other server with spare capacity, and
+    // only if there is none it waits in the selected server's bounded queue.
+    // May replace selected_server; returns an empty permit on overload.
+    ConcurrencyLimiter::Permit admit(ServerSpan servers, Server*& selected_server);
+
+    grpc::Status forward(grpc::ServerContext* context,
+                         Server& selected_server,
+                         ConcurrencyLimiter::Permit& permit,
+                         const loadbalancer::Request* request,
+                         loadbalancer::Response* response,
+                         std::chrono::microseconds& latency);
+
+    std::shared_ptr<ServerManager> server_manager_;
+};
+
+// Dispatches through the virtual Strategy interface; the strategy can be
+// swapped at runtime and plugins registered in StrategyRegistry work here.
+class LoadBalancerService final : public LoadBalancerServiceBase {
+public:
+    LoadBalancerService(std::shared_ptr<ServerManager> server_manager,
+                       std::shared_ptr<StrategyManager> strategy_manager);
+
+    grpc::Status HandleRequest(
+        grpc::ServerContext* context,
+        const loadbalancer::Request* request,
+        loadbalancer::Response* response) override;
+
+private:
+    std::shared_ptr<StrategyManager> strategy_manager_;
+};
+
+// Owns a built-in strategy by value and calls it non-virtually, so the
+// selection can be inlined into HandleRequest. The strategy is fixed for the
+// lifetime of the service.
+template <typename StrategyT>
+class LoadBalancerServiceT final : public LoadBalancerServiceBase {
+public:
+    explicit LoadBalancerServiceT(std::shared_ptr<ServerManager> server_manager)
+        : LoadBalancerServiceBase(std::move(server_manager)) {}
+
+    grpc::Status HandleRequest(
+        grpc::ServerContext* context,
+        const loadbalancer::Request* request,
+        loadbalancer::Response* response) override {
+        return dispatch(context, request, response,
+            [this, request](ServerSpan servers) {
+                return strategy_.StrategyT::selectIndex(servers, *request);
+            },
+            [this](Server& server, std::chrono::microseconds latency, bool success) {
+                strategy_.StrategyT::onRequestFinished(server, latency, success);
+            });
+    }
+
+private:
+    StrategyT strategy_;
+};
+
+extern template class LoadBalancerServiceT<RoundRobinStrategy>;
+extern template class LoadBalancerServiceT<PerWorkerRoundRobinStrategy>;
+extern template class LoadBalancerServiceT<LeastConnectionsStrategy>;
+extern template class LoadBalancerServiceT<LeastOutstandingRequestsStrategy>;
+extern template class LoadBalancerServiceT<ResourceBasedStrategy>;
+extern template class LoadBalancerServiceT<JoinIdleQueueStrategy>;
+
+// Returns a LoadBalancerServiceT for a built-in strategy name, or nullptr if
+// the strategy has no specialised path (e.g. plugins).
+std::unique_ptr<loadbalancer::LoadBalancerService::Service> createSpecializedService(
+    const std::string& strategy_name,
+    std::shared_ptr<ServerManager> server_manager);
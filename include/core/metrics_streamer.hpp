@@ -0,0 +1,39 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <string>
+#include "core/server.hpp"
+
+template <typename Rpc>
+class BackendStreams;
+struct MetricsRpc;
+
+// Keeps one StreamMetrics call open per backend and folds every sample the
+// backend pushes (CPU, memory, in-flight, queue depth) into its Server, so
+// routing sees load changes within one stream interval instead of one
+// health check period. Streams that end are reopened with backoff; backends
+// that don't implement StreamMetrics are left to the health checker's
+// polling.
+class MetricsStreamer {
+public:
+    struct Options {
+        std::chrono::milliseconds interval{250};       // 0 disables streaming
+        double min_change = 1.0;                        // CPU/memory percentage points
+        std::chrono::milliseconds max_silence{1000};   // backend keepalive period
+    };
+
+    explicit MetricsStreamer(const Options& options);
+    // Cancels every stream and waits for them to finish
+    ~MetricsStreamer();
+
+    MetricsStreamer(const MetricsStreamer&) = delete;
+    MetricsStreamer& operator=(const MetricsStreamer&) = delete;
+
+    bool isEnabled() const { return streams_ != nullptr; }
+
+    void watch(const std::shared_ptr<Server>& server);
+    void unwatch(const std::string& id);
+
+private:
+    std::unique_ptr<BackendStreams<MetricsRpc>> streams_;
+};
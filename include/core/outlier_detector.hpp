@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/server.hpp"
+
+// Passive outlier detection from the data path. Servers are ejected from
+// routing when they return too many consecutive failures, when their error
+// rate over the window is too high, or when their mean latency is far above
+// the rest of the pool. An ejection lasts base_ejection_time multiplied by
+// how often the server has been ejected recently (doubling, capped at
+// max_ejection_time), after which it is readmitted automatically.
+//
+// eject() and analyze() must be called with the ServerManager lock held.
+class OutlierDetector {
+public:
+    struct Options {
+        bool enabled = true;
+        int consecutive_failures = 5;             // 0 disables
+        std::chrono::milliseconds interval{1000};  // bucket width / analysis period
+        uint64_t min_requests = 20;                // per server over the window
+        double failure_rate_threshold = 0.5;
+        double latency_stdev_factor = 2.0;         // 0 disables latency ejection
+        std::chrono::milliseconds base_ejection_time{30000};
+        std::chrono::milliseconds max_ejection_time{300000};
+        int max_ejection_percent = 50;
+    };
+
+    explicit OutlierDetector(const Options& options);
+
+    bool isEnabled() const { return options_.enabled; }
+
+    // Records one forwarded call; returns true while the server is at or past
+    // the consecutive failure threshold and should be considered for ejection.
+    // The streak restarts when the server is ejected.
+    bool record(Server& server, bool success, std::chrono::microseconds latency);
+
+    // True for exactly one caller once per interval
+    bool isAnalysisDue();
+
+    bool eject(Server& server, const std::vector<std::shared_ptr<Server>>& servers, const std::string& reason);
+    // Readmits servers whose ejection expired, rotates windows and ejects
+    // servers that are outliers on error rate or latency. Returns true if
+    // any server was ejected or readmitted.
+    bool analyze(const std::vector<std::shared_ptr<Server>>& servers);
+
+private:
+    bool canEject(const std::vector<std::shared_ptr<Server>>& servers) const;
+
+    Options options_;
+    std::atomic<int64_t> next_analysis_ns_{0};
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Request outcomes seen by the load balancer for one server over a sliding
+// window of buckets, plus its ejection state. Written lock-free from the
+// request path; rotation and ejection are driven by OutlierDetector.
+class OutlierStats {
+public:
+    static constexpr size_t kBuckets = 10;
+
+    struct Totals {
+        uint64_t successes = 0;
+        uint64_t failures = 0;
+        uint64_t latency_us = 0;  // summed over successful requests
+
+        uint64_t requests() const { return successes + failures; }
+    };
+
+    // Returns the number of consecutive failures including this outcome
+    int record(bool success, std::chrono::microseconds latency);
+    Totals getTotals() const;
+    // Starts a new bucket, dropping the oldest one from the window
+    void advance();
+
+    bool isEjected() const { return ejected_.load(std::memory_order_acquire); }
+
+private:
+    friend class OutlierDetector;
+
+    struct Bucket {
+        std::atomic<uint64_t> successes{0};
+        std::atomic<uint64_t> failures{0};
+        std::atomic<uint64_t> latency_us{0};
+    };
+
+    std::array<Bucket, kBuckets> buckets_;
+    std::atomic<size_t> current_{0};
+    std::atomic<int> consecutive_failures_{0};
+
+    std::atomic<bool> ejected_{false};
+    // Only touched by OutlierDetector under the ServerManager lock
+    std::chrono::steady_clock::time_point ejected_until_;
+    int ejection_multiplier_ = 0;
+};
@@ -1,16 +1,42 @@
-#pragma once
-#include "core/process/process.hpp"
-
-class LinuxProcess : public Process {
-public:
-    LinuxProcess();
-    ~LinuxProcess();
-    bool start(const std::string& command) override;
-    bool isRunning() override;
-    void terminate() override;
-    int getExitCode() override;
-    double getCPUUsage() override;
-    double getMemoryUsage() override;
-private:
-    pid_t pid_;
+#pragma once
+#include "core/process/process.hpp"
+#include "core/process/proc_sampler.hpp"
+#include <memory>
+#include <mutex>
+#include <sys/types.h>
+
+class LinuxProcess : public Process {
+public:
+    LinuxProcess();
+    ~LinuxProcess();
+    bool start(const std::string& command) override;
+    bool isRunning() override;
+    void terminate() override;
+    int getExitCode() override;
+    double getCPUUsage() override;
+    double getMemoryUsage() override;
+    double getCPUPressure() override;
+    double getMemoryPressure() override;
+    void setNumaNode(int node) override { numa_node_ = node; }
+    void setCgroup(const std::string& path) override { cgroup_path_ = path; }
+    bool hasCgroupAccounting() const override { return in_cgroup_; }
+    void setHeartbeatFd(int fd) override { heartbeat_fd_ = fd; }
+    int getExitFd() const override { return pidfd_; }
+private:
+    // Collects the exit status if the child is gone; true once it has exited.
+    // After that pid_ may belong to another process, so it is never
+    // signalled or waited on again.
+    bool reap();
+
+    pid_t pid_;
+    int pidfd_ = -1;
+    std::mutex reap_mutex_;
+    bool exited_ = false;
+    int exit_status_ = 0;
+    int numa_node_ = -1;
+    std::string cgroup_path_;
+    bool in_cgroup_ = false;
+    int heartbeat_fd_ = -1;
+    // Latest sample of the child, or of this process until one is started
+    std::shared_ptr<const ProcSampler::Sample> sample_;
 };
\ No newline at end of file
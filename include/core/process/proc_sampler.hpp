@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/types.h>
+
+// Background sampler for Linux processes. One thread reads /proc/<pid>/stat
+// and /proc/<pid>/statm for every tracked process once per interval and
+// publishes CPU usage (over the last interval) and resident memory into
+// per-process slots, so readers never touch /proc or take a lock.
+// Processes in their own cgroup v2 leaf are measured from the leaf's
+// cpu.stat and memory.current instead, which also covers their threads and
+// children, and get CPU and memory pressure from the PSI files.
+class ProcSampler {
+public:
+    struct Sample {
+        std::atomic<double> cpu_usage{0.0};  // percent of one core
+        std::atomic<double> memory_mb{0.0};  // resident set size
+        // Share of the last 10s some tasks were stalled on CPU / memory,
+        // in percent; cgroup-tracked processes only
+        std::atomic<double> cpu_pressure{0.0};
+        std::atomic<double> memory_pressure{0.0};
+    };
+
+    static ProcSampler& getInstance();
+
+    ProcSampler(const ProcSampler&) = delete;
+    ProcSampler& operator=(const ProcSampler&) = delete;
+
+    // The process is sampled for as long as the returned slot is held.
+    // Values read 0 until the first full interval has passed.
+    std::shared_ptr<const Sample> track(pid_t pid);
+    // Same, for a process that runs in its own cgroup leaf
+    std::shared_ptr<const Sample> trackCgroup(pid_t pid, const std::string& cgroup);
+
+private:
+    explicit ProcSampler(std::chrono::milliseconds interval);
+
+    struct Tracked {
+        pid_t pid;
+        std::string cgroup;  // empty for per-process sampling
+        std::weak_ptr<Sample> sample;
+        uint64_t last_ticks = 0;  // clock ticks, or usec for cgroups
+        std::chrono::steady_clock::time_point last_time;
+        bool primed = false;
+    };
+
+    void run();
+    std::shared_ptr<const Sample> add(Tracked tracked);
+    void sample(Tracked& tracked, std::chrono::steady_clock::time_point now);
+    void sampleCgroup(Tracked& tracked, Sample& slot, std::chrono::steady_clock::time_point now);
+    void sampleMemory(pid_t pid, Sample& slot);
+
+    std::chrono::milliseconds interval_;
+    double ticks_per_second_;
+    double page_size_mb_;
+    std::mutex mutex_;
+    // Handed over to the sampler thread at the start of each pass
+    std::vector<Tracked> added_;
+    // Only touched by the sampler thread
+    std::vector<Tracked> tracked_;
+    std::thread thread_;
+};
@@ -1,14 +1,38 @@
-#pragma once
-#include <string>
-#include <iostream>
-
-class Process {
-public:
-    virtual ~Process() = default;
-    virtual bool start(const std::string& command) = 0;
-    virtual bool isRunning() = 0;
-    virtual void terminate() = 0;
-    virtual int getExitCode() = 0;
-    virtual double getCPUUsage() = 0;
-    virtual double getMemoryUsage() = 0;
+#pragma once
+#include <string>
+#include <iostream>
+
+class Process {
+public:
+    virtual ~Process() = default;
+    virtual bool start(const std::string& command) = 0;
+    virtual bool isRunning() = 0;
+    virtual void terminate() = 0;
+    virtual int getExitCode() = 0;
+    // Latest CPU usage (percent of one core) and resident memory (MB) of the
+    // started process; a process that was never started reports on the
+    // calling process, which is how backends measure themselves. Neither
+    // call blocks.
+    virtual double getCPUUsage() = 0;
+    virtual double getMemoryUsage() = 0;
+    // Percent of recent time the process was stalled waiting for CPU /
+    // memory; 0 where unknown
+    virtual double getCPUPressure() { return 0.0; }
+    virtual double getMemoryPressure() { return 0.0; }
+    // Bind the process to a NUMA node's CPUs and memory; must be called before
+    // start(). Platforms without support ignore it.
+    virtual void setNumaNode(int node) {}
+    // Start the process in the given cgroup v2 leaf, which it then owns;
+    // must be called before start(). Platforms without support ignore it.
+    virtual void setCgroup(const std::string& path) {}
+    // True when usage comes from the process's own cgroup, which accounts
+    // for all of its threads and children
+    virtual bool hasCgroupAccounting() const { return false; }
+    // Hand the process a heartbeat page: the fd is inherited and its number
+    // passed in LB_HEARTBEAT_FD. Must be called before start(); platforms
+    // without support ignore it.
+    virtual void setHeartbeatFd(int fd) {}
+    // Becomes readable once the started process exits (a pidfd on Linux);
+    // -1 where unsupported. isRunning() then reaps it.
+    virtual int getExitFd() const { return -1; }
 };
\ No newline at end of file
@@ -1,8 +1,8 @@
-#pragma once
-#include "process.hpp"
-#include <memory>
-
-class ProcessFactory {
-public:
-    static std::unique_ptr<Process> createProcess();
+#pragma once
+#include "process.hpp"
+#include <memory>
+
+class ProcessFactory {
+public:
+    static std::unique_ptr<Process> createProcess();
 };
\ No newline at end of file
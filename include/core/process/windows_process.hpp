@@ -1,19 +1,31 @@
-#pragma once
-#include "core/process/process.hpp"
-#include <windows.h>
-#include <psapi.h>
-
-class WindowsProcess : public Process {
-public:
-    WindowsProcess();
-    ~WindowsProcess();
-    bool start(const std::string& command) override;
-    bool isRunning() override;
-    void terminate() override;
-    int getExitCode() override;
-    double getCPUUsage() override;
-    double getMemoryUsage() override;
-private:
-    HANDLE process_handle_;
-    DWORD sampleIntervalMs = 1000;
+#pragma once
+#include "core/process/process.hpp"
+#include <cstdint>
+#include <mutex>
+#include <windows.h>
+#include <psapi.h>
+
+class WindowsProcess : public Process {
+public:
+    WindowsProcess();
+    ~WindowsProcess();
+    bool start(const std::string& command) override;
+    bool isRunning() override;
+    void terminate() override;
+    int getExitCode() override;
+    double getCPUUsage() override;
+    double getMemoryUsage() override;
+private:
+    // The child once started, this process before that
+    HANDLE measuredHandle() const;
+
+    HANDLE process_handle_;
+    // CPU usage is measured between successive calls instead of sleeping
+    // inside one; the first call only records the starting point
+    std::mutex cpu_mutex_;
+    uint64_t last_cpu_time_ = 0;
+    uint64_t last_wall_time_ = 0;
+    double last_cpu_usage_ = 0.0;
+    // Calls closer together than this return the previous value
+    static constexpr uint64_t MIN_SAMPLE_INTERVAL_100NS = 100 * 10000;  // 100ms
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "core/server.hpp"
+
+// Learns about backend exits the moment they happen: every backend's exit
+// fd (a pidfd) is registered with one epoll instance, waited on by a single
+// thread. Backends whose process has no exit fd (older kernels, Windows)
+// are left to the health checks.
+class ProcessExitMonitor {
+public:
+    struct Options {
+        bool enabled = true;
+    };
+    // Called from the monitor thread without any ProcessExitMonitor lock
+    // held, once per exited backend
+    using Callback = std::function<void(Server& server)>;
+
+    ProcessExitMonitor(const Options& options, Callback on_exit);
+    ~ProcessExitMonitor();
+
+    ProcessExitMonitor(const ProcessExitMonitor&) = delete;
+    ProcessExitMonitor& operator=(const ProcessExitMonitor&) = delete;
+
+    bool isEnabled() const { return epoll_fd_ >= 0; }
+
+    // Returns false if the server's process can't be watched
+    bool watch(const std::shared_ptr<Server>& server);
+    void unwatch(const std::string& id);
+
+private:
+    struct Entry {
+        std::string id;
+        std::weak_ptr<Server> server;
+        int fd;
+    };
+
+    void run();
+
+    Callback on_exit_;
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;  // eventfd that stops run()
+    std::mutex mutex_;
+    // By epoll key; ids map to keys so unwatch can find the entry
+    std::unordered_map<uint64_t, Entry> entries_;
+    std::unordered_map<std::string, uint64_t> keys_;
+    uint64_t next_key_ = 1;  // 0 is the wake fd
+    std::thread thread_;
+};
@@ -1,47 +1,146 @@
-#pragma once
-#include <string>
-#include <cstdint>
-#include <atomic>
-#include <chrono>
-#include "core/process/process.hpp"
-#include <iostream>
-
-class Server {
-public:
-    Server(const std::string& host, int port);
-    std::string getAddress() const;
-    int getPort() const;
-    std::string getId() const;
-    bool isHealthy() const;
-    void setHealthStatus(bool status);
-
-    double getCPUUsage() const;
-    void setCPUUsage(double usage);
-    double getMemoryUsage() const;
-    void setMemoryUsage(double usage);
-    
-    std::chrono::system_clock::time_point getLastHealthCheckTime() const;
-    void setLastHealthCheckTime(std::chrono::system_clock::time_point t);
-    
-    int getRequestCount() const { return request_count_.load(); }
-    void incrementRequestCount() { request_count_.fetch_add(1); }
-    
-    void incrementActiveConnections();
-    void decrementActiveConnections();
-    int getActiveConnections() const;
-
-    void setProcess(std::unique_ptr<Process> proc) { process_ = std::move(proc); }
-    Process* getProcess() const { return process_.get(); }
-
-private:
-    std::string host_;
-    int port_;
-    bool is_healthy_;
-    std::string id_;
-    std::chrono::system_clock::time_point last_health_check_time_;
-    std::atomic<int> request_count_{0};
-    std::atomic<int> active_connections_{0};
-    std::unique_ptr<Process> process_;
-    double cpu_usage;
-    double memory_usage;
+#pragma once
+#include <string>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <grpcpp/channel.h>
+#include "proto/admin_service.grpc.pb.h"
+#include "core/concurrency_limiter.hpp"
+#include "core/latency_tracker.hpp"
+#include "core/outlier_stats.hpp"
+#include "core/slow_start.hpp"
+#include "core/process/process.hpp"
+#include "utils/timer_wheel.hpp"
+#include <iostream>
+
+class Server {
+public:
+    Server(const std::string& host, int port,
+           const ConcurrencyLimiter::Options& limiter_options = ConcurrencyLimiter::Options());
+    ~Server();
+    std::string getAddress() const;
+    int getPort() const;
+    std::string getId() const;
+    // Stable hash of the id, for hash-based subsetting
+    uint64_t getIdHash() const { return id_hash_; }
+    bool isHealthy() const;
+    void setHealthStatus(bool status);
+
+    double getCPUUsage() const;
+    void setCPUUsage(double usage);
+    double getMemoryUsage() const;
+    void setMemoryUsage(double usage);
+    // PSI stall percentages from the backend's cgroup, 0 without one
+    double getCPUPressure() const { return process_ ? process_->getCPUPressure() : 0.0; }
+    double getMemoryPressure() const { return process_ ? process_->getMemoryPressure() : 0.0; }
+
+    // Load the backend reports about itself over its metrics stream
+    uint32_t getBackendInFlight() const { return backend_in_flight_.load(std::memory_order_relaxed); }
+    uint32_t getBackendQueueDepth() const { return backend_queue_depth_.load(std::memory_order_relaxed); }
+    void setBackendLoad(uint32_t in_flight, uint32_t queue_depth);
+    
+    std::chrono::system_clock::time_point getLastHealthCheckTime() const;
+    void setLastHealthCheckTime(std::chrono::system_clock::time_point t);
+    
+    int getRequestCount() const { return request_count_.load(); }
+    void incrementRequestCount() { request_count_.fetch_add(1); }
+    
+    void incrementActiveConnections();
+    void decrementActiveConnections();
+    int getActiveConnections() const;
+
+    void setProcess(std::unique_ptr<Process> proc) { process_ = std::move(proc); }
+    Process* getProcess() const { return process_.get(); }
+
+    // Starts the slow-start ramp (from now) under the given policy. The
+    // factor is stepped on the shared timer wheel, so reading it never
+    // touches the clock.
+    void startRamp(const SlowStartPolicy& policy);
+    // Fraction of its normal traffic share the server should get, in (0, 1]
+    double getRampFactor() const;
+
+    // NUMA node the backend process is bound to, -1 if unbound
+    int getNumaNode() const { return numa_node_; }
+    void setNumaNode(int node) { numa_node_ = node; }
+
+    // Draining servers stay routable but are skipped by filter pipelines
+    // with a not_draining stage
+    bool isDraining() const { return draining_.load(std::memory_order_relaxed); }
+    void setDraining(bool draining) { draining_.store(draining, std::memory_order_relaxed); }
+
+    // Ejected by outlier detection: healthy, but temporarily not routed to
+    bool isEjected() const { return outlier_stats_.isEjected(); }
+    OutlierStats& getOutlierStats() { return outlier_stats_; }
+
+    // Latency of successful calls forwarded to this server
+    LatencyTracker& getLatencyTracker() { return latency_tracker_; }
+    const LatencyTracker& getLatencyTracker() const { return latency_tracker_; }
+
+    // Position in the latest published ServerSnapshot; a hint for strategies
+    // that remember servers across requests and need their index again
+    size_t getSnapshotIndex() const { return snapshot_index_.load(std::memory_order_relaxed); }
+    void setSnapshotIndex(size_t index) { snapshot_index_.store(index, std::memory_order_relaxed); }
+
+    ConcurrencyLimiter& getLimiter() { return limiter_; }
+    const ConcurrencyLimiter& getLimiter() const { return limiter_; }
+
+    // Channel to the backend, created on first use and shared by all requests
+    std::shared_ptr<grpc::Channel> getChannel();
+    // AdminService stub over that channel (e.g. for load probes), created on
+    // first use; stubs are safe to share between threads
+    admin::AdminService::Stub& getAdminStub();
+
+private:
+    std::string host_;
+    int port_;
+    // Written by health watches, heartbeats and exit monitoring while
+    // strategies read them without a lock
+    std::atomic<bool> is_healthy_;
+    std::string id_;
+    uint64_t id_hash_;
+    std::atomic<bool> draining_{false};
+    std::atomic<std::chrono::system_clock::time_point> last_health_check_time_;
+    std::atomic<int> request_count_{0};
+    std::atomic<int> active_connections_{0};
+    std::unique_ptr<Process> process_;
+    std::atomic<double> cpu_usage{0.0};
+    std::atomic<double> memory_usage{0.0};
+    std::atomic<uint32_t> backend_in_flight_{0};
+    std::atomic<uint32_t> backend_queue_depth_{0};
+    int numa_node_ = -1;
+    SlowStartPolicy slow_start_;
+    std::chrono::steady_clock::time_point ramp_start_;
+    std::atomic<bool> ramp_done_{true};
+    std::atomic<double> ramp_factor_{1.0};
+    std::atomic<TimerService::TimerId> ramp_timer_{0};
+    void advanceRamp();
+    ConcurrencyLimiter limiter_;
+    OutlierStats outlier_stats_;
+    LatencyTracker latency_tracker_;
+    std::atomic<size_t> snapshot_index_{0};
+    std::once_flag channel_once_;
+    std::shared_ptr<grpc::Channel> channel_;
+    std::once_flag admin_stub_once_;
+    std::unique_ptr<admin::AdminService::Stub> admin_stub_;
+};
+
+// Counts one forwarded call against a server for as long as it is alive, so
+// the in-flight count is restored on every exit path (errors, cancellations,
+// exceptions).
+class ActiveConnectionGuard {
+public:
+    explicit ActiveConnectionGuard(Server& server) : server_(server) {
+        server_.incrementActiveConnections();
+    }
+    ~ActiveConnectionGuard() {
+        server_.decrementActiveConnections();
+    }
+
+    ActiveConnectionGuard(const ActiveConnectionGuard&) = delete;
+    ActiveConnectionGuard& operator=(const ActiveConnectionGuard&) = delete;
+
+private:
+    Server& server_;
 };
\ No newline at end of file
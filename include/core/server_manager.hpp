@@ -1,43 +1,137 @@
-#pragma once
-#include <vector>
-#include <memory>
-#include <mutex>
-#include <iostream>
-#include "core/server.hpp"
-#include "core/process/process_factory.hpp"
-
-class ServerManager {
-public:
-    ServerManager(const std::string& executable_path, 
-                 int start_port,
-                 size_t min_servers,
-                 size_t max_servers);
-    
-    std::vector<std::shared_ptr<Server>> getAllServers();
-    std::shared_ptr<Server> findServerById(const std::string& id);
-    void updateServerHealth(const std::string& id, bool health, double cpu_usage, double memory_usage);
-    bool removeServerById(const std::string& id);
-    std::shared_ptr<Server> addServer();
-    std::vector<std::shared_ptr<Server>> getActiveServers();
-    struct ServerStats {
-        size_t total_servers;
-        size_t active_servers;
-        size_t inactive_servers;
-        size_t min_servers;
-        size_t max_servers;
-    };
-    ServerStats getServerStats();
-    // int findAvailablePort();
-    
-private:
-    std::string executable_path_;
-    int next_port_;
-    int start_port_;
-    size_t min_servers_;
-    size_t max_servers_;
-    std::atomic<size_t> active_servers;
-    std::vector<std::shared_ptr<Server>> servers_;
-    std::mutex mutex_;
-    // std::set<int> available_ports_;
-    // const size_t max_port_range_ = 1000;
+#pragma once
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <iostream>
+#include "core/server.hpp"
+#include "core/health_watcher.hpp"
+#include "core/heartbeat_monitor.hpp"
+#include "core/metrics_streamer.hpp"
+#include "core/outlier_detector.hpp"
+#include "core/process_exit_monitor.hpp"
+#include "core/process/process_factory.hpp"
+#include "utils/cgroup.hpp"
+
+// Immutable view of the servers the request path may route to (healthy and
+// not ejected), grouped by NUMA node. A new one is published whenever that
+// set changes; requests hold on to the one they started with.
+struct ServerSnapshot {
+    std::vector<std::shared_ptr<Server>> servers;
+};
+
+struct ServerManagerOptions {
+    ConcurrencyLimiter::Options limiter;
+    // Spread backends across NUMA nodes and bind each to its node
+    bool numa_placement = false;
+    SlowStartPolicy slow_start;
+    OutlierDetector::Options outlier_detection;
+    MetricsStreamer::Options metrics_stream;
+    HealthWatcher::Options health_watch;
+    HeartbeatMonitor::Options heartbeat;
+    ProcessExitMonitor::Options exit_monitor;
+    // Give each backend its own cgroup v2 leaf when delegation allows it
+    bool cgroups = true;
+    CgroupTree::Limits cgroup_limits;
+};
+
+// One server's entry in a health update batch; unset fields are left alone
+struct HealthUpdate {
+    std::string id;
+    std::optional<bool> healthy;
+    std::optional<double> cpu_usage;
+    std::optional<double> memory_usage;
+};
+
+class ServerManager {
+public:
+    using Options = ServerManagerOptions;
+
+    ServerManager(const std::string& executable_path, 
+                 int start_port,
+                 size_t min_servers,
+                 size_t max_servers,
+                 const Options& options = Options());
+    ~ServerManager();
+    
+    std::vector<std::shared_ptr<Server>> getAllServers();
+    std::shared_ptr<Server> findServerById(const std::string& id);
+    // Applies the batch under one lock and republishes the snapshot at most
+    // once, only if some server's health changed. With a non-zero
+    // base_version nothing is applied, and false returned, unless the
+    // registry is still at that version.
+    bool updateServerHealth(const std::vector<HealthUpdate>& updates, uint64_t base_version = 0);
+    bool removeServerById(const std::string& id);
+    // Returns false if no server has that id. A non-zero timeout removes
+    // the server once it has been draining that long.
+    bool setServerDraining(const std::string& id, bool draining,
+                           std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+    std::shared_ptr<Server> addServer();
+    // Healthy servers, and the registry version they were read at
+    std::vector<std::shared_ptr<Server>> getActiveServers(uint64_t* registry_version = nullptr);
+    // Current routing snapshot; lock-free, costs one reference count
+    std::shared_ptr<const ServerSnapshot> getSnapshot() const { return std::atomic_load(&snapshot_); }
+    // Copy of the snapshot's servers
+    std::vector<std::shared_ptr<Server>> getRoutableServers();
+    // Feeds the outcome of a forwarded call to outlier detection
+    void recordRequestOutcome(Server& server, bool success, std::chrono::microseconds latency);
+    struct ServerStats {
+        size_t total_servers;
+        size_t active_servers;
+        size_t inactive_servers;
+        size_t min_servers;
+        size_t max_servers;
+    };
+    ServerStats getServerStats();
+    // int findAvailablePort();
+    
+private:
+    std::string executable_path_;
+    int next_port_;
+    int start_port_;
+    size_t min_servers_;
+    size_t max_servers_;
+    std::atomic<size_t> active_servers{0};
+    Options options_;
+
+    int pickNumaNode() const;
+    // Rebuilds and publishes snapshot_; mutex_ must be held
+    void publishSnapshot();
+    // Flips the server's health and republishes the snapshot; mutex_ must be
+    // held. Returns false if it already had that health.
+    bool setServing(Server& server, bool serving);
+    // Applies a transition reported by a health watch; a server that stops
+    // serving is replaced straight away
+    void onServingChanged(Server& server, bool serving);
+    // Applies a transition reported by the heartbeat monitor. A stalled
+    // server only leaves rotation: stalls are often transient (throttling,
+    // a long pause), so it is replaced only if it hasn't recovered after a
+    // grace period or its process exits.
+    void onHeartbeatChanged(Server& server, bool serving);
+    void onStallTimeout(const std::string& id);
+    void onDrainTimeout(const std::string& id);
+    // Reaps a backend whose process has exited, then takes it out of
+    // rotation and replaces it
+    void onProcessExited(Server& server);
+    std::vector<std::shared_ptr<Server>> servers_;
+    std::unordered_map<std::string, std::shared_ptr<Server>> servers_by_id_;
+    std::mutex mutex_;
+    // Bumped (under mutex_) when a server is added, removed or changes
+    // health; starts at 1 so that 0 can mean "unconditional"
+    uint64_t registry_version_ = 1;
+    // Pending drain timeouts by server id
+    std::unordered_map<std::string, TimerService::TimerId> drain_timers_;
+    // Pending replacements of stalled servers by server id
+    std::unordered_map<std::string, TimerService::TimerId> stall_timers_;
+    OutlierDetector outlier_detector_;
+    std::shared_ptr<const ServerSnapshot> snapshot_;
+    // Declared after servers_ so streams are cancelled before servers go away
+    MetricsStreamer metrics_streamer_;
+    HealthWatcher health_watcher_;
+    HeartbeatMonitor heartbeat_monitor_;
+    // Last, so it stops before anything its callback uses goes away
+    ProcessExitMonitor exit_monitor_;
+    // std::set<int> available_ports_;
+    // const size_t max_port_range_ = 1000;
 };
\ No newline at end of file
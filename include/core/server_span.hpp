@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class Server;
+
+// Non-owning view of a contiguous run of servers, typically a published
+// ServerSnapshot. Indexing hands out references to the owning shared_ptrs,
+// so reading through a span never touches a reference count; whoever made
+// the span keeps the underlying storage alive. Every element must be a real
+// owning pointer: strategies copy one to keep a server past the call.
+class ServerSpan {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    ServerSpan() = default;
+    ServerSpan(const std::shared_ptr<Server>* data, size_t size)
+        : data_(data), size_(size) {}
+    ServerSpan(const std::vector<std::shared_ptr<Server>>& servers)
+        : data_(servers.data()), size_(servers.size()) {}
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const std::shared_ptr<Server>& operator[](size_t index) const { return data_[index]; }
+    const std::shared_ptr<Server>* begin() const { return data_; }
+    const std::shared_ptr<Server>* end() const { return data_ + size_; }
+
+    ServerSpan subspan(size_t offset, size_t count) const { return ServerSpan(data_ + offset, count); }
+
+private:
+    const std::shared_ptr<Server>* data_ = nullptr;
+    size_t size_ = 0;
+};
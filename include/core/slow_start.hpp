@@ -0,0 +1,17 @@
+#pragma once
+#include <chrono>
+
+// Ramp applied to a newly added backend's share of traffic. The factor starts
+// at min_factor when the backend is added and reaches 1.0 once the window
+// has passed, either linearly or exponentially (doubling-style growth that
+// stays low while caches are coldest).
+struct SlowStartPolicy {
+    enum class Mode { Linear, Exponential };
+
+    std::chrono::milliseconds window{0};  // 0 disables slow start
+    double min_factor = 0.1;
+    Mode mode = Mode::Linear;
+
+    bool isEnabled() const { return window.count() > 0; }
+    double factorAt(std::chrono::steady_clock::duration age) const;
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "strategies/strategy.hpp"
+
+// Owns the strategy used by the request path and allows it to be replaced at
+// runtime. Readers take a shared_ptr copy of the current strategy, so a swap
+// never blocks them and the previous instance stays alive until every
+// in-flight selection that grabbed it has finished.
+class StrategyManager {
+public:
+    explicit StrategyManager(const std::string& initial_strategy);
+
+    std::shared_ptr<Strategy> getStrategy() const;
+    std::string getStrategyName() const;
+    std::vector<std::string> getAvailableStrategies() const;
+
+    // Returns false (and keeps the current strategy) if the name is unknown
+    // or the strategy has been pinned.
+    bool setStrategy(const std::string& name);
+
+    // Set when the request path was specialised for the current strategy at
+    // startup (--pin-strategy); later setStrategy() calls are rejected.
+    void pin() { pinned_ = true; }
+    bool isPinned() const { return pinned_; }
+
+private:
+    struct ActiveStrategy {
+        std::string name;
+        std::shared_ptr<Strategy> strategy;
+    };
+
+    std::shared_ptr<const ActiveStrategy> active_;
+    std::atomic<bool> pinned_{false};
+};
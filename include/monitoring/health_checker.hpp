@@ -1,48 +1,111 @@
-#pragma once
-#include <memory>
-#include <thread>
-#include <atomic>
-#include <chrono>
-#include <vector>
-#include <string>
-#include <WinSock2.h>
-#include <WS2tcpip.h>
-#include <grpcpp/grpcpp.h>
-#include "proto/admin_service.grpc.pb.h"
-
-#pragma comment(lib, "Ws2_32.lib")
-
-// Constants
-extern const double SCALE_UP_CPU_THRESHOLD;
-extern const double SCALE_DOWN_CPU_THRESHOLD;
-extern int health_checker_sleep_time;
-
-class HealthChecker {
-public:
-    explicit HealthChecker(const std::string& lb_admin_address);
-    ~HealthChecker();
-
-    // Non-copyable
-    HealthChecker(const HealthChecker&) = delete;
-    HealthChecker& operator=(const HealthChecker&) = delete;
-
-    void start();
-    void stop();
-    void checkServersOnce(); 
-
-private:
-    void checkHealth();
-    
-    std::vector<admin::ServerInfo> listAllServers();
-    bool isServerResponding(const std::string& host, int port);
-    void updateServerHealth(const std::vector<admin::UpdateServerHealthRequest>& updates);
-    bool getServerMetrics(const std::string& host, int port, double& outCpu, double& outMem);
-    admin::ServerConstraintsResponse getServerLimits();
-    void addServer();
-    void removeServer(const std::string& serverId);
-    void handleAutoScaling(double cpu, const std::string& serverId, const admin::ServerConstraintsResponse& constraints);
-
-    std::atomic<bool> running_;
-    std::unique_ptr<std::thread> health_check_thread_;
-    std::unique_ptr<admin::AdminService::Stub> admin_stub_;
+#pragma once
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <grpcpp/grpcpp.h>
+#include "proto/admin_service.grpc.pb.h"
+#include "monitoring/lb_control.hpp"
+#include "monitoring/tcp_prober.hpp"
+#include "utils/timer_wheel.hpp"
+
+// Constants
+extern const double SCALE_UP_CPU_THRESHOLD;
+extern const double SCALE_DOWN_CPU_THRESHOLD;
+extern int health_checker_sleep_time;
+
+// Probes the backends, collects their metrics and scales the pool. Runs
+// either as the standalone health_checker binary, talking to the LB over
+// the admin API, or inside load_balancer against its ServerManager.
+//
+// Once started, each server is probed on its own jittered timer: steady
+// servers back off to a longer interval, failing ones are re-probed
+// quickly, and a server is only marked down after consecutive failures.
+// Servers that come due within a short window of each other are probed in
+// one batch, and batches reuse the last server listing until the next
+// discovery pass or until the registry changes.
+class HealthChecker {
+public:
+    // External mode: drives the load balancer at the given admin address
+    explicit HealthChecker(const std::string& lb_admin_address);
+    // In-process mode
+    explicit HealthChecker(std::shared_ptr<ServerManager> server_manager);
+    ~HealthChecker();
+
+    // Non-copyable
+    HealthChecker(const HealthChecker&) = delete;
+    HealthChecker& operator=(const HealthChecker&) = delete;
+
+    void start();
+    void stop();
+    // Probes every listed server once, outside of any schedule
+    void checkServersOnce(); 
+
+private:
+    void checkHealth();
+    // Probes the given servers (all of them if null) plus any not seen
+    // before, retrying while the registry keeps changing
+    void checkServers(const std::unordered_set<std::string>* due);
+
+    // Scaling decided during a sweep; carried out only after the sweep's
+    // health update is accepted, so the update's base version still holds
+    struct ScalingPlan {
+        size_t servers_to_add = 0;
+        std::vector<std::string> servers_to_remove;
+    };
+    // One probe/update pass; false if the registry changed underneath it
+    bool runSweep(const std::unordered_set<std::string>* due);
+
+    // Per-server probe schedule, only used by the checker thread
+    struct ProbeState {
+        TimerService::TimerId timer = 0;
+        std::chrono::milliseconds interval{0};
+        int consecutive_ok = 0;
+        int consecutive_failures = 0;
+    };
+    // Servers marked down aren't listed any more and just lose their state
+    enum class ProbeOutcome {
+        Ok,
+        MetricsFailed,
+        Suspect  // failed, but not often enough in a row to mark it down
+    };
+    void applyOutcome(const std::string& id, ProbeOutcome outcome);
+    void scheduleProbe(const std::string& id, ProbeState& state);
+    void cancelProbes();
+
+    struct ServerMetrics {
+        bool ok = false;
+        double cpu = 0.0;
+        double memory = 0.0;
+    };
+    // Calls GetMetrics on every responding server concurrently; one result
+    // per server, ok=false for servers skipped or failed
+    std::vector<ServerMetrics> getServerMetrics(const std::vector<admin::ServerInfo>& servers,
+                                                const std::vector<bool>& responding);
+    // Persistent stub per server id, created on first use
+    admin::AdminService::Stub& getMetricsStub(const admin::ServerInfo& server);
+    void handleAutoScaling(double cpu, const std::string& serverId, const admin::ServerConstraintsResponse& constraints,
+                           ScalingPlan& plan);
+
+    std::atomic<bool> running_;
+    std::unique_ptr<std::thread> health_check_thread_;
+    // Lets stop() and due probe timers cut the sleep between passes short
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::unordered_set<std::string> due_;
+    std::unordered_map<std::string, ProbeState> probe_states_;
+    // Last listing and constraints, only used by the checker thread
+    LoadBalancerControl::ServerListing listing_;
+    admin::ServerConstraintsResponse constraints_;
+    std::chrono::steady_clock::time_point listed_at_;
+    bool listing_valid_ = false;
+    std::unique_ptr<LoadBalancerControl> control_;
+    TcpProber prober_;
+    std::unordered_map<std::string, std::unique_ptr<admin::AdminService::Stub>> metrics_stubs_;
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "proto/admin_service.grpc.pb.h"
+
+class ServerManager;
+
+// What the health checker needs from the load balancer. The remote version
+// goes through the admin gRPC API (the standalone health_checker binary);
+// the local one calls ServerManager directly when the checker runs inside
+// load_balancer, so results reach the routing snapshot without any RPC.
+class LoadBalancerControl {
+public:
+    struct ServerListing {
+        uint64_t registry_version = 0;
+        std::vector<admin::ServerInfo> servers;
+    };
+    enum class UpdateResult {
+        Applied,
+        Conflict,  // the registry moved past the batch's base_version
+        Failed
+    };
+
+    virtual ~LoadBalancerControl() = default;
+
+    virtual ServerListing listServers() = 0;
+    virtual admin::ServerConstraintsResponse getServerConstraints() = 0;
+    virtual UpdateResult updateServerHealth(const admin::UpdateServerHealthRequests& updates) = 0;
+    virtual void addServer() = 0;
+    virtual void removeServer(const std::string& serverId) = 0;
+};
+
+class RemoteLoadBalancerControl : public LoadBalancerControl {
+public:
+    explicit RemoteLoadBalancerControl(const std::string& lb_admin_address);
+
+    ServerListing listServers() override;
+    admin::ServerConstraintsResponse getServerConstraints() override;
+    UpdateResult updateServerHealth(const admin::UpdateServerHealthRequests& updates) override;
+    void addServer() override;
+    void removeServer(const std::string& serverId) override;
+
+private:
+    std::unique_ptr<admin::AdminService::Stub> admin_stub_;
+};
+
+class LocalLoadBalancerControl : public LoadBalancerControl {
+public:
+    explicit LocalLoadBalancerControl(std::shared_ptr<ServerManager> server_manager);
+
+    ServerListing listServers() override;
+    admin::ServerConstraintsResponse getServerConstraints() override;
+    UpdateResult updateServerHealth(const admin::UpdateServerHealthRequests& updates) override;
+    void addServer() override;
+    void removeServer(const std::string& serverId) override;
+
+private:
+    std::shared_ptr<ServerManager> server_manager_;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+
+// TCP connect probes for many endpoints at once. On Linux all connects are
+// started non-blocking and completed from a single epoll loop, so a sweep
+// takes about as long as the slowest reachable endpoint (or the timeout)
+// rather than the sum over all endpoints.
+class TcpProber {
+public:
+    struct Endpoint {
+        std::string host;  // IPv4 address
+        int port;
+    };
+
+    explicit TcpProber(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
+    // One result per endpoint, true if a TCP connection was established
+    // within the timeout
+    std::vector<bool> probeAll(const std::vector<Endpoint>& endpoints) const;
+
+private:
+    std::chrono::milliseconds timeout_;
+};
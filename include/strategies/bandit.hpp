@@ -0,0 +1,32 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <chrono>
+#include <memory>
+#include <vector>
+
+// Thompson sampling over per-server latency. Each server's log-latency is
+// modelled as a normal distribution from its LatencyTracker; a selection
+// draws a plausible mean latency for each of up to kSampleSize random
+// servers and picks the one with the lowest expected completion time
+// (sampled latency x requests in flight, per unit of ramp weight). Servers
+// with little recent data get wide draws and are explored; the tracker's
+// decay lets the choice follow backends whose speed changes. Failed calls
+// are recorded as taking at least kFailurePenalty, so a backend that fails
+// fast doesn't look fast.
+//
+// Cost is O(kSampleSize) regardless of pool size, unless every sampled
+// server is unhealthy; then the pool is scanned for a healthy one.
+class BanditStrategy final : public Strategy {
+public:
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+    void onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) override;
+
+private:
+    static constexpr size_t kSampleSize = 8;
+    static constexpr std::chrono::milliseconds kFailurePenalty{1000};
+    // Spread of the draw for a server with no measurements (log space)
+    static constexpr double kPriorStddev = 2.0;
+
+    static double sampleLatencyMs(const Server& server);
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Narrows the server list through a fixed sequence of filter stages and
+// lets another strategy pick from what is left. Declared as
+// "filter=<stage>,<stage>,...:<strategy>", e.g.
+// "filter=healthy,not_draining,same_node,tenant:p2c".
+//
+// The stage list is parsed once. Per request each stage is one pass over
+// the span producing a bitmask, ANDed into the running mask. A stage that
+// would leave no servers is skipped (fail open). If every server survives,
+// the pick strategy gets the original span. Otherwise the survivors are
+// copied as owning pointers (the pick strategy may hold on to them past the
+// call) into a reused per-thread buffer, one per nesting level, so a
+// pipeline can pick through another pipeline.
+//
+// Stages:
+//   healthy       server is healthy
+//   not_draining  server has not been marked draining
+//   same_node     server is on the request thread's NUMA node
+//   has_headroom  server is below its concurrency limit
+//   tenant        server is in the request tenant's hash subset (about
+//                 kTenantSubsetSize servers, stable as the pool changes)
+class FilterPipelineStrategy final : public Strategy {
+public:
+    enum class Stage { Healthy, NotDraining, SameNode, HasHeadroom, Tenant };
+
+    // Returns nullptr if a stage name is unknown. An empty list means
+    // "healthy,not_draining".
+    static std::shared_ptr<FilterPipelineStrategy> create(std::shared_ptr<Strategy> pick, const std::string& stages);
+
+    FilterPipelineStrategy(std::shared_ptr<Strategy> pick, std::vector<Stage> stages);
+
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+    void onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) override;
+
+private:
+    static constexpr double kTenantSubsetSize = 4.0;
+
+    std::shared_ptr<Strategy> pick_;
+    std::vector<Stage> stages_;
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Join-Idle-Queue: when a server's last in-flight request completes it joins
+// the idle queue of a randomly chosen worker. Each request thread first
+// takes a server from its own idle queue and only falls back to
+// power-of-two-choices on in-flight counts when that queue is empty, so the
+// common case needs neither a shared counter nor a scan of the pool.
+//
+// Queue entries are hints: a server that became busy again, or left the
+// snapshot, is discarded when it is popped. An entry's server is only
+// dereferenced once it has been found in the current span, since a server
+// that left the snapshot may already be gone.
+class JoinIdleQueueStrategy final : public Strategy {
+public:
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+    void onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) override;
+
+private:
+    static constexpr size_t kMaxWorkers = 64;
+    static constexpr size_t kQueueCapacity = 64;  // power of two
+    static constexpr size_t kMaxStalePops = 4;
+
+    struct IdleEntry {
+        const Server* server;
+        size_t snapshot_index;  // when it was pushed; a hint for indexOf
+    };
+
+    // Bounded lock-free MPMC ring (Vyukov). Any thread may push; pops come
+    // from the owning worker, or several when there are more than kMaxWorkers.
+    class alignas(64) IdleQueue {
+    public:
+        IdleQueue();
+        bool push(const IdleEntry& entry);
+        bool pop(IdleEntry& entry);
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            IdleEntry entry;
+        };
+
+        std::array<Cell, kQueueCapacity> cells_;
+        alignas(64) std::atomic<size_t> enqueue_pos_{0};
+        alignas(64) std::atomic<size_t> dequeue_pos_{0};
+    };
+
+    std::array<IdleQueue, kMaxWorkers> queues_;
+    // Number of worker queues that have been polled; idle servers are only
+    // pushed to those so they don't sit in queues nobody reads
+    std::atomic<size_t> workers_seen_{1};
+};
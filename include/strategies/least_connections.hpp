@@ -1,10 +1,10 @@
-#include "strategies/strategy.hpp"
-#include "core/server.hpp"
-#include <vector>
-#include <memory>
-
-class LeastConnectionsStrategy : public Strategy {
-public:
-    std::shared_ptr<Server> selectServer(const std::vector<std::shared_ptr<Server>>& servers,
-                                         const loadbalancer::Request& request) override;
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <vector>
+#include <memory>
+
+class LeastConnectionsStrategy final : public Strategy {
+public:
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
 };
\ No newline at end of file
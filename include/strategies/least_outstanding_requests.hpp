@@ -0,0 +1,13 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <vector>
+#include <memory>
+
+// Picks the healthy server with the fewest requests currently in flight
+// through the load balancer. Ties are broken uniformly at random, so equally
+// loaded servers share traffic instead of the first one taking all of it.
+class LeastOutstandingRequestsStrategy final : public Strategy {
+public:
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+};
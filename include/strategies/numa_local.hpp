@@ -0,0 +1,21 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <vector>
+#include <memory>
+
+// Wraps another strategy and keeps traffic on the NUMA node of the worker
+// thread handling the request: while any healthy backend on that node still
+// has concurrency headroom, the inner strategy only chooses among that
+// node's backends, and it sees the full list when none do. Backends without
+// a node (placement disabled) count as remote.
+class NumaLocalStrategy final : public Strategy {
+public:
+    explicit NumaLocalStrategy(std::shared_ptr<Strategy> inner);
+
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+    void onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) override;
+
+private:
+    std::shared_ptr<Strategy> inner_;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Round robin without a shared counter: every request thread advances its
+// own cache-line sized cursor, each starting at a random offset so the
+// workers together still spread requests evenly. The cursor is reduced
+// modulo the current server count on every call, so it stays valid when
+// servers are added or removed between calls.
+class PerWorkerRoundRobinStrategy final : public Strategy {
+public:
+    PerWorkerRoundRobinStrategy();
+
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+
+private:
+    static constexpr size_t kMaxWorkers = 64;
+
+    struct alignas(64) Cursor {
+        std::atomic<uint64_t> next{0};
+    };
+
+    // Threads beyond kMaxWorkers share cursors, which stays correct because
+    // the cursor is still advanced atomically.
+    std::array<Cursor, kMaxWorkers> cursors_;
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+
+// Samples two servers at random and sends the request to the one with
+// fewer requests in flight (per unit of slow-start weight). O(1) per
+// request and close to least-outstanding-requests in practice.
+class PowerOfTwoChoicesStrategy final : public Strategy {
+public:
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override {
+        return pickTwoChoices(servers);
+    }
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include "strategies/strategy.hpp"
+#include "core/server.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Probe-based selection after Prequal (Wydrowski et al., NSDI '24). Probing
+// follows traffic: requests bump a counter, and a background issuer on the
+// shared timer thread turns it into asynchronous ProbeLoad RPCs to random
+// backends, so the request path never issues one. Replies (in-flight count
+// and latency estimate) go into a small pool of recent probes, and requests
+// are routed by the hot/cold rule: probes whose in-flight count is above the
+// pool's hot quantile are hot; the cold probe with the lowest latency wins,
+// or the hot one with the fewest in flight if every probe is hot. Falls back
+// to power of two choices while the pool is empty.
+//
+// The pool is published as an immutable set, like the server snapshot, and
+// rebuilt by probe replies; selection reads it without taking a lock.
+class PrequalStrategy final : public Strategy {
+public:
+    PrequalStrategy();
+    ~PrequalStrategy() override;
+
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) override;
+
+private:
+    static constexpr size_t kPoolSize = 16;
+    static constexpr double kProbesPerRequest = 1.0;
+    static constexpr size_t kMaxOutstandingProbes = 32;
+    static constexpr int kMaxProbeUses = 2;
+    static constexpr double kHotQuantile = 0.84;
+    static constexpr std::chrono::milliseconds kMaxProbeAge{500};
+    static constexpr std::chrono::milliseconds kProbeTimeout{50};
+    static constexpr std::chrono::milliseconds kIssueInterval{10};
+    // The probe targets are also refreshed every this many requests, since
+    // a reused span (e.g. a filter pipeline's buffer) can change in place
+    static constexpr uint64_t kTargetRefreshRequests = 256;
+
+    // server is only compared against the span, never dereferenced: it may
+    // have left the snapshot and been freed since the probe came back
+    struct Probe {
+        const Server* server = nullptr;
+        size_t snapshot_index = 0;  // when the reply arrived; a hint for indexOf
+        double latency_ms = 0.0;
+        std::chrono::steady_clock::time_point received;
+        // Bumped by the selections that use the probe, in a published set
+        mutable std::atomic<uint32_t> in_flight{0};
+        mutable std::atomic<int> uses{0};
+    };
+
+    struct ProbeSet {
+        std::array<Probe, kPoolSize> probes;
+        size_t size = 0;
+    };
+
+    // Shared with in-flight probe callbacks, which may outlive the strategy
+    // when it is swapped out
+    struct ProbePool {
+        std::mutex mutex;  // serialises rebuilds of current
+        std::shared_ptr<const ProbeSet> current;  // atomic_load/atomic_store
+        std::atomic<size_t> outstanding{0};
+
+        void add(const Server* server, size_t snapshot_index, uint32_t in_flight, double latency_ms);
+    };
+
+    void refreshTargets(ServerSpan servers);
+    // Runs on the timer thread every kIssueInterval
+    void issueProbes();
+    static void sendProbe(std::shared_ptr<ProbePool> pool, std::shared_ptr<Server> server);
+
+    std::shared_ptr<ProbePool> pool_;
+    std::atomic<uint64_t> requests_{0};
+    // Servers the issuer probes, copied from the spans requests see
+    std::mutex targets_mutex_;
+    std::shared_ptr<const std::vector<std::shared_ptr<Server>>> targets_;  // atomic_load/atomic_store
+    std::atomic<const std::shared_ptr<Server>*> targets_data_{nullptr};
+    std::atomic<size_t> targets_size_{0};
+    // Issuer state, only touched on the timer thread
+    uint64_t probed_requests_ = 0;
+    double probe_carry_ = 0.0;
+    std::atomic<TimerService::TimerId> issue_timer_{0};
+};
@@ -1,13 +1,55 @@
-#pragma once
-#include <memory>
-#include <vector>
-#include "proto/load_balancer.pb.h"
-#include "core/server.hpp"
-
-class Strategy {
-public:
-    virtual ~Strategy() = default;
-    virtual std::shared_ptr<Server> selectServer(
-        const std::vector<std::shared_ptr<Server>>& servers,
-        const loadbalancer::Request& request) = 0;
-};
\ No newline at end of file
+#pragma once
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "proto/load_balancer.pb.h"
+#include "core/server.hpp"
+#include "core/server_span.hpp"
+#include "utils/random.hpp"
+
+// The request path calls selectIndex(), which should not allocate. Strategies
+// written against the older vector-based selectServer() derive from
+// LegacyStrategy below instead.
+class Strategy {
+public:
+    static constexpr size_t npos = ServerSpan::npos;
+
+    virtual ~Strategy() = default;
+
+    // Returns the position of the chosen server in servers, or npos
+    virtual size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) = 0;
+
+    // Called once a forwarded call to a server this strategy picked has
+    // completed and no longer counts as in flight. Strategies that learn
+    // from completions override it; the default does nothing.
+    virtual void onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) {}
+
+protected:
+    // For strategies that pick without comparing load: accepts a candidate
+    // with probability equal to its slow-start ramp factor.
+    static bool passesRamp(const Server& server) {
+        double factor = server.getRampFactor();
+        return factor >= 1.0 || fastRandomUnit() < factor;
+    }
+
+    // Power of two choices on in-flight requests per unit of ramp weight
+    static size_t pickTwoChoices(ServerSpan servers);
+
+    // Index of server in the span, or npos if it is not in it. Tries hint
+    // (a snapshot index the caller read while it knew the server was alive)
+    // before falling back to a scan. server is only compared, never
+    // dereferenced, so it may point at a server that has since been freed.
+    static size_t indexOf(ServerSpan servers, const Server* server, size_t hint);
+};
+
+// Adapter for strategies that pick from a vector of servers: selectIndex()
+// copies the span into a per-thread vector, calls selectServer() and maps
+// the result back to its position.
+class LegacyStrategy : public Strategy {
+public:
+    virtual std::shared_ptr<Server> selectServer(
+        const std::vector<std::shared_ptr<Server>>& servers,
+        const loadbalancer::Request& request) = 0;
+
+    size_t selectIndex(ServerSpan servers, const loadbalancer::Request& request) final;
+};
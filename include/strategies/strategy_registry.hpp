@@ -0,0 +1,41 @@
+#pragma once
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "strategies/strategy.hpp"
+
+// Maps strategy names (as used on the command line and by the admin APIs)
+// to factories. Built-in strategies are registered on first use; plugins can
+// add their own with registerStrategy().
+//
+// Decorators wrap another strategy and are named "<decorator>:<inner>",
+// e.g. "numa_local:least_outstanding_requests". A decorator may take an
+// argument string as "<decorator>=<args>:<inner>", e.g.
+// "filter=healthy,tenant:p2c"; its factory returns nullptr if the
+// arguments are invalid.
+class StrategyRegistry {
+public:
+    using Factory = std::function<std::shared_ptr<Strategy>()>;
+    using DecoratorFactory = std::function<std::shared_ptr<Strategy>(std::shared_ptr<Strategy>, const std::string&)>;
+
+    static StrategyRegistry& getInstance();
+
+    StrategyRegistry(const StrategyRegistry&) = delete;
+    StrategyRegistry& operator=(const StrategyRegistry&) = delete;
+
+    void registerStrategy(const std::string& name, Factory factory);
+    void registerDecorator(const std::string& name, DecoratorFactory factory);
+    std::shared_ptr<Strategy> create(const std::string& name) const;
+    bool contains(const std::string& name) const;
+    std::vector<std::string> getNames() const;
+
+private:
+    StrategyRegistry();
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Factory> factories_;
+    std::map<std::string, DecoratorFactory> decorators_;
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// cgroup v2 leaves for backends, created under the load balancer's own
+// cgroup. Needs a writable (delegated) cgroup v2 hierarchy, e.g. a systemd
+// unit with Delegate=yes; without one isAvailable() is false and backends
+// simply run in the load balancer's cgroup.
+class CgroupTree {
+public:
+    struct Limits {
+        double cpu_cores = 0.0;    // cpu.max, 0 = unlimited
+        uint64_t memory_mb = 0;    // memory.max, 0 = unlimited
+    };
+
+    static CgroupTree& getInstance();
+
+    bool isAvailable() const { return !root_.empty(); }
+
+    // Creates (or reuses) the leaf `name` and applies the limits; a limit
+    // whose controller isn't enabled is skipped with a warning. Returns the
+    // leaf's directory, or "" if it couldn't be created.
+    std::string createLeaf(const std::string& name, const Limits& limits);
+
+    // Kills whatever is left in the leaf and removes it
+    static void removeLeaf(const std::string& path);
+
+private:
+    CgroupTree();
+
+    // Directory the leaves are created in; "" when unavailable
+    std::string root_;
+    bool cpu_controller_ = false;
+    bool memory_controller_ = false;
+};
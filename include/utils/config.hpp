@@ -1,36 +1,57 @@
-#pragma once
-#include <string>
-#include "strategies/round_robin.hpp"
-
-// Declare as extern to indicate they're defined elsewhere
-extern std::string server_address;
-extern std::string load_balancer_address;
-extern int health_checker_sleep_time;
-
-struct Config {
-    std::string backend_path;
-    int lb_port = 50050;
-    int start_port = 50051;
-    size_t min_servers = 2;
-    size_t max_servers = 5;
-};
-
-class Configuration {
-private:
-    Configuration() {};
-    static std::shared_ptr<Configuration> instance;
-public:
-    Configuration(const Configuration&) = delete;
-    Configuration& operator=(const Configuration&) = delete;
-
-    static std::shared_ptr<Configuration> getInstance() {
-        if (instance == nullptr) {
-            instance = std::shared_ptr<Configuration>(new Configuration());
-        }
-        return instance;
-    }
-
-    std::shared_ptr<Strategy> getStrategy() {
-        return std::make_shared<RoundRobinStrategy>();
-    };
+#pragma once
+#include <string>
+#include "strategies/strategy_registry.hpp"
+
+// Declare as extern to indicate they're defined elsewhere
+extern std::string server_address;
+extern std::string load_balancer_address;
+extern int health_checker_sleep_time;
+
+struct Config {
+    std::string backend_path;
+    int lb_port = 50050;
+    int start_port = 50051;
+    size_t min_servers = 2;
+    size_t max_servers = 5;
+    std::string strategy = "round_robin";
+    bool pin_strategy = false;
+    size_t max_queue = 16;
+    int queue_timeout_ms = 100;
+    bool numa_placement = false;
+    int slow_start_ms = 0;
+    std::string slow_start_mode = "linear";
+    double slow_start_min_factor = 0.1;
+    bool outlier_detection = true;
+    int outlier_consecutive_failures = 5;
+    int outlier_base_ejection_ms = 30000;
+    int outlier_max_ejection_percent = 50;
+    int metrics_stream_ms = 250;
+    bool health_watch = true;
+    bool embedded_health_checker = false;
+    bool cgroups = true;
+    bool heartbeat = true;
+    int heartbeat_stall_ms = 1000;
+    int heartbeat_wedge_ms = 5000;
+    double cgroup_cpu_max = 0.0;
+    int cgroup_memory_max_mb = 0;
+};
+
+class Configuration {
+private:
+    Configuration() {};
+    static std::shared_ptr<Configuration> instance;
+public:
+    Configuration(const Configuration&) = delete;
+    Configuration& operator=(const Configuration&) = delete;
+
+    static std::shared_ptr<Configuration> getInstance() {
+        if (instance == nullptr) {
+            instance = std::shared_ptr<Configuration>(new Configuration());
+        }
+        return instance;
+    }
+
+    std::shared_ptr<Strategy> getStrategy(const std::string& name) {
+        return StrategyRegistry::getInstance().create(name);
+    };
 };
\ No newline at end of file
@@ -1,53 +1,145 @@
-#include "utils/config.hpp"
-#include <iostream>
-
-void printUsage(const char* programName) {
-    std::cerr << "Usage: " << programName << " [options]\n"
-              << "Options:\n"
-              << "  --backend-path PATH   Path to backend server executable (required)\n"
-              << "  --port PORT           Load balancer port (default: 50050)\n"
-              << "  --min-servers N       Minimum number of backend servers (default: 2)\n"
-              << "  --max-servers N       Maximum number of backend servers (default: 5)\n"
-              << "  --start-port N        Starting port for backend servers (default: 50051)\n";
-}
-
-Config parseArgs(int argc, char** argv) {
-    Config config;
-    
-    for (int i = 1; i < argc; i++) {
-        std::string arg = argv[i];
-        
-        if (i + 1 >= argc && arg != "--help" && arg != "-h") {
-            std::cerr << "Error: Missing value for argument " << arg << std::endl;
-            printUsage(argv[0]);
-            exit(1);
-        }
-        
-        try {
-            if (arg == "--backend-path") {
-                config.backend_path = argv[++i];
-            } else if (arg == "--port") {
-                config.lb_port = static_cast<int>(std::stoi(argv[++i]));
-            } else if (arg == "--min-servers") {
-                config.min_servers = static_cast<size_t>(std::stoi(argv[++i]));
-            } else if (arg == "--max-servers") {
-                config.max_servers = static_cast<size_t>(std::stoi(argv[++i]));
-            } else if (arg == "--start-port") {
-                config.start_port = static_cast<int>(std::stoi(argv[++i]));
-            } else if (arg == "--help" || arg == "-h") {
-                printUsage(argv[0]);
-                exit(0);
-            } else {
-                std::cerr << "Unknown argument: " << arg << std::endl;
-                printUsage(argv[0]);
-                exit(1);
-            }
-        } catch (const std::exception& e) {
-            std::cerr << "Error parsing argument " << arg << ": " << e.what() << std::endl;
-            printUsage(argv[0]);
-            exit(1);
-        }
-    }
-    
-    return config;
+#include "utils/config.hpp"
+#include <iostream>
+
+void printUsage(const char* programName) {
+    std::cerr << "Usage: " << programName << " [options]\n"
+              << "Options:\n"
+              << "  --backend-path PATH   Path to backend server executable (required)\n"
+              << "  --port PORT           Load balancer port (default: 50050)\n"
+              << "  --min-servers N       Minimum number of backend servers (default: 2)\n"
+              << "  --max-servers N       Maximum number of backend servers (default: 5)\n"
+              << "  --start-port N        Starting port for backend servers (default: 50051)\n"
+              << "  --strategy NAME       Load balancing strategy (default: round_robin)\n"
+              << "                        Available:";
+    for (const auto& name : StrategyRegistry::getInstance().getNames()) {
+        std::cerr << " " << name;
+    }
+    std::cerr << "\n"
+              << "  --pin-strategy        Compile-time specialised dispatch for a built-in strategy\n"
+              << "                        (faster, but disables runtime strategy changes)\n"
+              << "  --max-queue N         Requests held per server once it hits its concurrency limit (default: 16)\n"
+              << "  --queue-timeout-ms N  How long a queued request waits for a slot (default: 100)\n"
+              << "  --numa-placement      Spread backends across NUMA nodes and bind them to their node\n"
+              << "  --slow-start-ms N     Ramp a new server's traffic share up over N ms (default: 0, off)\n"
+              << "  --slow-start-mode M   linear or exponential (default: linear)\n"
+              << "  --slow-start-min-factor F  Initial share of a new server, 0-1 (default: 0.1)\n"
+              << "  --no-outlier-detection  Don't eject servers based on request errors and latency\n"
+              << "  --outlier-consecutive-failures N  Failures in a row that eject a server (default: 5, 0 = off)\n"
+              << "  --outlier-base-ejection-ms N  First ejection period, doubled on repeat (default: 30000)\n"
+              << "  --outlier-max-ejection-percent N  Most servers that may be ejected at once (default: 50)\n"
+              << "  --metrics-stream-ms N  Backends push load samples every N ms (default: 250, 0 = off)\n"
+              << "  --no-health-watch     Don't hold a grpc.health.v1 Watch stream open to each backend\n"
+              << "  --health-checker      Run the health checker inside the load balancer\n"
+              << "                        (instead of as the separate health_checker process)\n"
+              << "  --no-heartbeat        Don't give backends a shared-memory heartbeat page\n"
+              << "  --heartbeat-stall-ms N  Heartbeat silence that takes a backend out of rotation (default: 1000)\n"
+              << "  --heartbeat-wedge-ms N  Time with requests in flight but none completed that does the same (default: 5000)\n"
+              << "  --no-cgroups          Don't give each backend its own cgroup v2 leaf\n"
+              << "  --cgroup-cpu-max C    Limit each backend to C CPU cores (default: 0, unlimited)\n"
+              << "  --cgroup-memory-max-mb N  Limit each backend's memory to N MB (default: 0, unlimited)\n";
+}
+
+// Arguments that don't take a value
+bool isSwitchArgument(const std::string& arg) {
+    return arg == "--help" || arg == "-h"
+        || arg == "--pin-strategy"
+        || arg == "--numa-placement"
+        || arg == "--no-outlier-detection"
+        || arg == "--no-health-watch"
+        || arg == "--health-checker"
+        || arg == "--no-cgroups"
+        || arg == "--no-heartbeat";
+}
+
+Config parseArgs(int argc, char** argv) {
+    Config config;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        
+        if (i + 1 >= argc && !isSwitchArgument(arg)) {
+            std::cerr << "Error: Missing value for argument " << arg << std::endl;
+            printUsage(argv[0]);
+            exit(1);
+        }
+        
+        try {
+            if (arg == "--backend-path") {
+                config.backend_path = argv[++i];
+            } else if (arg == "--port") {
+                config.lb_port = static_cast<int>(std::stoi(argv[++i]));
+            } else if (arg == "--min-servers") {
+                config.min_servers = static_cast<size_t>(std::stoi(argv[++i]));
+            } else if (arg == "--max-servers") {
+                config.max_servers = static_cast<size_t>(std::stoi(argv[++i]));
+            } else if (arg == "--start-port") {
+                config.start_port = static_cast<int>(std::stoi(argv[++i]));
+            } else if (arg == "--strategy") {
+                config.strategy = argv[++i];
+                if (!StrategyRegistry::getInstance().contains(config.strategy)) {
+                    std::cerr << "Unknown strategy: " << config.strategy << std::endl;
+                    printUsage(argv[0]);
+                    exit(1);
+                }
+            } else if (arg == "--max-queue") {
+                config.max_queue = static_cast<size_t>(std::stoi(argv[++i]));
+            } else if (arg == "--queue-timeout-ms") {
+                config.queue_timeout_ms = std::stoi(argv[++i]);
+            } else if (arg == "--slow-start-ms") {
+                config.slow_start_ms = std::stoi(argv[++i]);
+            } else if (arg == "--slow-start-mode") {
+                config.slow_start_mode = argv[++i];
+                if (config.slow_start_mode != "linear" && config.slow_start_mode != "exponential") {
+                    std::cerr << "Unknown slow start mode: " << config.slow_start_mode << std::endl;
+                    printUsage(argv[0]);
+                    exit(1);
+                }
+            } else if (arg == "--slow-start-min-factor") {
+                config.slow_start_min_factor = std::stod(argv[++i]);
+            } else if (arg == "--no-outlier-detection") {
+                config.outlier_detection = false;
+            } else if (arg == "--outlier-consecutive-failures") {
+                config.outlier_consecutive_failures = std::stoi(argv[++i]);
+            } else if (arg == "--outlier-base-ejection-ms") {
+                config.outlier_base_ejection_ms = std::stoi(argv[++i]);
+            } else if (arg == "--outlier-max-ejection-percent") {
+                config.outlier_max_ejection_percent = std::stoi(argv[++i]);
+            } else if (arg == "--metrics-stream-ms") {
+                config.metrics_stream_ms = std::stoi(argv[++i]);
+            } else if (arg == "--health-checker") {
+                config.embedded_health_checker = true;
+            } else if (arg == "--no-health-watch") {
+                config.health_watch = false;
+            } else if (arg == "--no-heartbeat") {
+                config.heartbeat = false;
+            } else if (arg == "--heartbeat-stall-ms") {
+                config.heartbeat_stall_ms = std::stoi(argv[++i]);
+            } else if (arg == "--heartbeat-wedge-ms") {
+                config.heartbeat_wedge_ms = std::stoi(argv[++i]);
+            } else if (arg == "--no-cgroups") {
+                config.cgroups = false;
+            } else if (arg == "--cgroup-cpu-max") {
+                config.cgroup_cpu_max = std::stod(argv[++i]);
+            } else if (arg == "--cgroup-memory-max-mb") {
+                config.cgroup_memory_max_mb = std::stoi(argv[++i]);
+            } else if (arg == "--numa-placement") {
+                config.numa_placement = true;
+            } else if (arg == "--pin-strategy") {
+                config.pin_strategy = true;
+            } else if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                exit(0);
+            } else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                printUsage(argv[0]);
+                exit(1);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Error parsing argument " << arg << ": " << e.what() << std::endl;
+            printUsage(argv[0]);
+            exit(1);
+        }
+    }
+    
+    return config;
 }
\ No newline at end of file
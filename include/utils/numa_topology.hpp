@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// NUMA layout of the host, read once from sysfs. On hosts without NUMA
+// information (or non-Linux builds) everything is reported as node 0.
+// Node ids need not be contiguous (offline or hot-pluggable nodes leave
+// gaps) and memory-only nodes have no CPUs; both show up as nodes with an
+// empty CPU list.
+class NumaTopology {
+public:
+    static const NumaTopology& getInstance();
+
+    // One past the highest node id
+    size_t getNodeCount() const { return node_cpus_.size(); }
+    const std::vector<int>& getCpus(int node) const { return node_cpus_[node]; }
+    bool hasCpus(int node) const {
+        return node >= 0 && node < static_cast<int>(node_cpus_.size()) && !node_cpus_[node].empty();
+    }
+    int getNodeOfCpu(int cpu) const;
+
+    // Node of the CPU the calling thread is running on right now
+    int getCurrentNode() const;
+
+private:
+    NumaTopology();
+
+    std::vector<std::vector<int>> node_cpus_;
+    std::vector<int> cpu_to_node_;
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <thread>
+
+// Cheap per-thread PRNG for the request path (splitmix64). Not for anything
+// security related.
+inline uint64_t fastRandom() {
+    static thread_local uint64_t state = [] {
+        std::random_device rd;
+        uint64_t seed = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+        seed ^= std::hash<std::thread::id>()(std::this_thread::get_id());
+        seed ^= static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        return seed;
+    }();
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Value in [0, bound); the modulo bias is negligible for server counts.
+inline size_t fastRandomBelow(size_t bound) {
+    return static_cast<size_t>(fastRandom() % bound);
+}
+
+// Uniform double in [0, 1)
+inline double fastRandomUnit() {
+    return static_cast<double>(fastRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Small dense index for the calling thread, assigned on first use. Request
+// threads use it to pick per-worker state (cursors, queues).
+inline size_t currentWorkerIndex() {
+    static std::atomic<size_t> next_index{0};
+    static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
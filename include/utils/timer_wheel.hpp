@@ -0,0 +1,119 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Hierarchical timing wheel: 4 levels of 256 slots, so scheduling and
+// cancelling are O(1) and advancing costs O(1) per tick plus an occasional
+// cascade, whatever the number of timers. With a 10ms tick it covers
+// delays of up to ~497 days. Timers live in one pooled vector and are
+// linked by index, so 100k timers don't mean 100k allocations.
+//
+// Not thread safe; TimerService wraps it with a lock and a thread.
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;  // 0 is never a valid id
+    using Callback = std::function<void()>;
+
+    TimerWheel(Clock::duration tick, Clock::time_point start);
+
+    TimerId schedule(Clock::time_point when, Callback callback);
+    // False if the timer already fired or was cancelled
+    bool cancel(TimerId id);
+
+    // Moves the callback of every timer due by `now` into `expired`, in
+    // expiry order
+    void advance(Clock::time_point now, std::vector<std::pair<TimerId, Callback>>& expired);
+
+    // When advance() may next have something to do; Clock::time_point::max()
+    // when no timers are pending
+    Clock::time_point nextWakeup() const;
+
+    size_t size() const { return active_; }
+
+private:
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 8;
+    static constexpr uint32_t kSlots = 1u << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    struct Node {
+        uint64_t expires = 0;    // tick
+        Callback callback;
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        uint32_t slot = kNil;    // index into heads_, kNil when free
+        uint32_t generation = 0;
+    };
+
+    uint64_t toTick(Clock::time_point t) const;
+    Clock::time_point tickTime(uint64_t tick) const { return start_ + tick_ * tick; }
+    // Links the node into the slot for its expiry relative to current_tick_
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    void cascade(int level, uint32_t slot);
+    void release(uint32_t index);
+
+    Clock::duration tick_;
+    Clock::time_point start_;
+    uint64_t current_tick_ = 0;  // next tick to process
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> free_;
+    std::array<uint32_t, kLevels * kSlots> heads_;
+    size_t active_ = 0;
+};
+
+// Process-wide timer thread on top of a TimerWheel, for periodic LB work:
+// health probe schedules, slow-start ramps, drain timeouts. Callbacks run
+// on the timer thread without any lock held, so they may schedule and
+// cancel timers themselves; they should be short and must not block.
+class TimerService {
+public:
+    using TimerId = TimerWheel::TimerId;
+    using Callback = TimerWheel::Callback;
+
+    // Never destroyed, so objects cancelling their timers during static
+    // destruction don't outlive it
+    static TimerService& getInstance();
+
+    explicit TimerService(std::chrono::milliseconds tick = std::chrono::milliseconds(10));
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+    TimerId schedule(std::chrono::steady_clock::duration delay, Callback callback);
+    // Cancels a pending timer. If its callback is running on another thread,
+    // waits for it to return, so the caller may then free what it uses.
+    bool cancel(TimerId id);
+    // Cancels a self-rescheduling timer whose callback stores the id of its
+    // next run in `timer` (0 once it stops)
+    void cancel(std::atomic<TimerId>& timer);
+
+    size_t size() const;
+
+private:
+    void run();
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable callback_done_;
+    TimerWheel wheel_;
+    // Timers taken off the wheel by the current advance, run in order;
+    // cancel() still reaches the ones not run yet
+    std::vector<std::pair<TimerId, Callback>> expired_;
+    size_t next_expired_ = 0;
+    TimerWheel::Clock::time_point planned_wakeup_;
+    TimerId running_id_ = 0;
+    bool stopping_ = false;
+    std::thread thread_;
+};
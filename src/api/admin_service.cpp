@@ -1,72 +1,127 @@
-#include "api/admin_service.hpp"
-
-AdminService::AdminService(std::shared_ptr<ServerManager> server_manager)
-    : server_manager_(std::move(server_manager)) {}
-
-::grpc::Status AdminService::ListServers(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::ListServersResponse* response) {
-    auto servers = server_manager_->getActiveServers(); 
-
-    for (const auto& server : servers) {
-        admin::ServerInfo* info = response->add_servers();
-        info->set_id(server->getId());
-        info->set_host(server->getAddress());
-        info->set_port(server->getPort());
-        info->set_ishealthy(server->isHealthy());
-        auto tp = server->getLastHealthCheckTime();
-        auto duration = std::chrono::duration_cast<std::chrono::seconds>(
-            tp.time_since_epoch());
-        info->set_last_health_check_unix_seconds(duration.count());
-        info->set_request_count(server->getRequestCount());
-    }
-
-    return ::grpc::Status::OK;
-}
-
-::grpc::Status AdminService::UpdateServerHealth(::grpc::ServerContext* context, const admin::UpdateServerHealthRequests* request, ::google::protobuf::Empty* response) {
-    try {
-        for (const auto& update : request->updates()) {
-            server_manager_->updateServerHealth(
-                update.id(),
-                update.ishealthy(),
-                update.cpu_usage(),
-                update.memory_usage()
-            );
-        }
-        return ::grpc::Status::OK;
-    } catch (const std::exception& e) {
-        std::cerr << "Exception in UpdateServerHealth: " << e.what() << std::endl;
-        return ::grpc::Status(::grpc::StatusCode::INTERNAL, 
-                            std::string("Server error: ") + e.what());
-    } catch (...) {
-        std::cerr << "Unknown exception in UpdateServerHealth" << std::endl;
-        return ::grpc::Status(::grpc::StatusCode::INTERNAL, 
-                            "Unknown server error");
-    }
-}
-
-::grpc::Status AdminService::AddServer( ::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::AddServerResponse* response) {
-    auto latestServer = server_manager_->addServer();
-    if (!latestServer) {
-        return ::grpc::Status(::grpc::StatusCode::RESOURCE_EXHAUSTED,
-                              "Max servers reached or cannot add");
-    }
-    response->set_id(latestServer->getId());
-    return ::grpc::Status::OK;
-}
-
-::grpc::Status AdminService::RemoveServer(::grpc::ServerContext* context, const admin::RemoveServerRequest* request, ::google::protobuf::Empty* response) {
-    bool success = server_manager_->removeServerById(request->id());
-    if (!success) {
-        return ::grpc::Status(::grpc::StatusCode::NOT_FOUND,
-                              "Could not remove server (not found or min servers reached)");
-    }
-    return ::grpc::Status::OK;
-}
-
-::grpc::Status AdminService::GetServerConstraints(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::ServerConstraintsResponse* response) {
-    auto sc = server_manager_->getServerStats();
-    response->set_min_servers(static_cast<int>(sc.min_servers));
-    response->set_max_servers(static_cast<int>(sc.max_servers));
-    response->set_active_servers(static_cast<int>(sc.active_servers));
-    return ::grpc::Status::OK;
-}
+#include "api/admin_service.hpp"
+
+AdminService::AdminService(std::shared_ptr<ServerManager> server_manager,
+                           std::shared_ptr<StrategyManager> strategy_manager)
+    : server_manager_(std::move(server_manager))
+    , strategy_manager_(std::move(strategy_manager)) {}
+
+::grpc::Status AdminService::ListServers(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::ListServersResponse* response) {
+    uint64_t registry_version = 0;
+    auto servers = server_manager_->getActiveServers(&registry_version);
+    response->set_registry_version(registry_version);
+
+    for (const auto& server : servers) {
+        admin::ServerInfo* info = response->add_servers();
+        info->set_id(server->getId());
+        info->set_host(server->getAddress());
+        info->set_port(server->getPort());
+        info->set_ishealthy(server->isHealthy());
+        auto tp = server->getLastHealthCheckTime();
+        auto duration = std::chrono::duration_cast<std::chrono::seconds>(
+            tp.time_since_epoch());
+        info->set_last_health_check_unix_seconds(duration.count());
+        info->set_request_count(server->getRequestCount());
+        info->set_cpu_usage(server->getCPUUsage());
+        info->set_memory_usage(server->getMemoryUsage());
+        info->set_concurrency_limit(server->getLimiter().getLimit());
+        info->set_in_flight(server->getLimiter().getInFlight());
+        info->set_queued(static_cast<uint32_t>(server->getLimiter().getQueued()));
+        info->set_numa_node(server->getNumaNode());
+        info->set_ejected(server->isEjected());
+        info->set_draining(server->isDraining());
+        info->set_backend_in_flight(server->getBackendInFlight());
+        info->set_backend_queue_depth(server->getBackendQueueDepth());
+    }
+
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status AdminService::UpdateServerHealth(::grpc::ServerContext* context, const admin::UpdateServerHealthRequests* request, ::google::protobuf::Empty* response) {
+    try {
+        if (!server_manager_->updateServerHealth(toHealthUpdates(*request), request->base_version())) {
+            return ::grpc::Status(::grpc::StatusCode::ABORTED,
+                                  "Server registry changed since version " + std::to_string(request->base_version()));
+        }
+        return ::grpc::Status::OK;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception in UpdateServerHealth: " << e.what() << std::endl;
+        return ::grpc::Status(::grpc::StatusCode::INTERNAL, 
+                            std::string("Server error: ") + e.what());
+    } catch (...) {
+        std::cerr << "Unknown exception in UpdateServerHealth" << std::endl;
+        return ::grpc::Status(::grpc::StatusCode::INTERNAL, 
+                            "Unknown server error");
+    }
+}
+
+std::vector<HealthUpdate> AdminService::toHealthUpdates(const admin::UpdateServerHealthRequests& request) {
+    bool delta = request.base_version() != 0;
+    std::vector<HealthUpdate> updates;
+    updates.reserve(request.updates_size());
+    for (const auto& update : request.updates()) {
+        HealthUpdate entry;
+        entry.id = update.id();
+        if (!delta || update.has_ishealthy()) {
+            entry.healthy = update.ishealthy();
+        }
+        if (!delta || update.has_cpu_usage()) {
+            entry.cpu_usage = update.cpu_usage();
+        }
+        if (!delta || update.has_memory_usage()) {
+            entry.memory_usage = update.memory_usage();
+        }
+        updates.push_back(std::move(entry));
+    }
+    return updates;
+}
+
+::grpc::Status AdminService::AddServer( ::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::AddServerResponse* response) {
+    auto latestServer = server_manager_->addServer();
+    if (!latestServer) {
+        return ::grpc::Status(::grpc::StatusCode::RESOURCE_EXHAUSTED,
+                              "Max servers reached or cannot add");
+    }
+    response->set_id(latestServer->getId());
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status AdminService::RemoveServer(::grpc::ServerContext* context, const admin::RemoveServerRequest* request, ::google::protobuf::Empty* response) {
+    bool success = server_manager_->removeServerById(request->id());
+    if (!success) {
+        return ::grpc::Status(::grpc::StatusCode::NOT_FOUND,
+                              "Could not remove server (not found or min servers reached)");
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status AdminService::GetServerConstraints(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, admin::ServerConstraintsResponse* response) {
+    auto sc = server_manager_->getServerStats();
+    response->set_min_servers(static_cast<int>(sc.min_servers));
+    response->set_max_servers(static_cast<int>(sc.max_servers));
+    response->set_active_servers(static_cast<int>(sc.active_servers));
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status AdminService::SetServerDraining(::grpc::ServerContext* context, const admin::SetServerDrainingRequest* request, ::google::protobuf::Empty* response) {
+    if (!server_manager_->setServerDraining(request->id(), request->draining(),
+                                            std::chrono::milliseconds(request->timeout_ms()))) {
+        return ::grpc::Status(::grpc::StatusCode::NOT_FOUND, "Server not found: " + request->id());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status AdminService::SetStrategy(::grpc::ServerContext* context, const admin::SetStrategyRequest* request, admin::StrategyResponse* response) {
+    if (strategy_manager_->isPinned()) {
+        return ::grpc::Status(::grpc::StatusCode::FAILED_PRECONDITION,
+                              "Strategy is pinned (--pin-strategy), restart to change it");
+    }
+    if (!strategy_manager_->setStrategy(request->name())) {
+        return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT,
+                              "Unknown strategy: " + request->name());
+    }
+    response->set_name(strategy_manager_->getStrategyName());
+    for (const auto& name : strategy_manager_->getAvailableStrategies()) {
+        response->add_available(name);
+    }
+    return ::grpc::Status::OK;
+}
@@ -0,0 +1,123 @@
+#include "core/concurrency_limiter.hpp"
+#include <algorithm>
+#include <cmath>
+
+ConcurrencyLimiter::Permit::Permit(ConcurrencyLimiter* limiter, int in_flight)
+    : limiter_(limiter)
+    , in_flight_at_start_(in_flight)
+    , start_(std::chrono::steady_clock::now()) {}
+
+ConcurrencyLimiter::Permit::Permit(Permit&& other) noexcept
+    : limiter_(other.limiter_)
+    , in_flight_at_start_(other.in_flight_at_start_)
+    , start_(other.start_)
+    , outcome_(other.outcome_) {
+    other.limiter_ = nullptr;
+}
+
+ConcurrencyLimiter::Permit& ConcurrencyLimiter::Permit::operator=(Permit&& other) noexcept {
+    if (this != &other) {
+        if (limiter_) {
+            limiter_->release(std::chrono::steady_clock::now() - start_, in_flight_at_start_, outcome_);
+        }
+        limiter_ = other.limiter_;
+        in_flight_at_start_ = other.in_flight_at_start_;
+        start_ = other.start_;
+        outcome_ = other.outcome_;
+        other.limiter_ = nullptr;
+    }
+    return *this;
+}
+
+ConcurrencyLimiter::Permit::~Permit() {
+    if (limiter_) {
+        limiter_->release(std::chrono::steady_clock::now() - start_, in_flight_at_start_, outcome_);
+    }
+}
+
+ConcurrencyLimiter::ConcurrencyLimiter()
+    : ConcurrencyLimiter(Options()) {}
+
+ConcurrencyLimiter::ConcurrencyLimiter(const Options& options)
+    : options_(options)
+    , limit_(options.initial_limit)
+    , estimated_limit_(options.initial_limit) {}
+
+bool ConcurrencyLimiter::tryIncrement(int& in_flight) {
+    in_flight = in_flight_.load(std::memory_order_relaxed);
+    while (in_flight < limit_.load(std::memory_order_relaxed)) {
+        if (in_flight_.compare_exchange_weak(in_flight, in_flight + 1, std::memory_order_acq_rel)) {
+            ++in_flight;
+            return true;
+        }
+    }
+    return false;
+}
+
+ConcurrencyLimiter::Permit ConcurrencyLimiter::tryAcquire() {
+    int in_flight = 0;
+    if (!tryIncrement(in_flight)) {
+        return Permit();
+    }
+    return Permit(this, in_flight);
+}
+
+ConcurrencyLimiter::Permit ConcurrencyLimiter::acquire() {
+    int in_flight = 0;
+    if (tryIncrement(in_flight)) {
+        return Permit(this, in_flight);
+    }
+
+    if (queued_.fetch_add(1) >= options_.max_queue) {
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return Permit();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool acquired = slot_available_.wait_for(lock, options_.queue_timeout,
+        [this, &in_flight] { return tryIncrement(in_flight); });
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    return acquired ? Permit(this, in_flight) : Permit();
+}
+
+void ConcurrencyLimiter::release(std::chrono::nanoseconds rtt, int in_flight_at_start, Outcome outcome) {
+    // seq_cst pairs with the queued_ increment in acquire() so a waiter either
+    // sees the freed slot or is counted here and gets notified
+    in_flight_.fetch_sub(1);
+
+    if (outcome != Outcome::Ignored) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        double new_limit = estimated_limit_;
+
+        if (outcome == Outcome::Dropped) {
+            new_limit = estimated_limit_ * 0.9;
+        } else if (in_flight_at_start >= estimated_limit_ / 2) {
+            // Samples taken while the backend was mostly idle say nothing about its capacity
+            double sample_ns = static_cast<double>(rtt.count());
+            if (long_rtt_ns_ == 0.0) {
+                long_rtt_ns_ = sample_ns;
+            } else {
+                long_rtt_ns_ += (sample_ns - long_rtt_ns_) / options_.long_window;
+                // Let the baseline recover quickly after a period of high latency
+                if (long_rtt_ns_ / sample_ns > 2.0) {
+                    long_rtt_ns_ *= 0.95;
+                }
+            }
+
+            double gradient = std::clamp(options_.rtt_tolerance * long_rtt_ns_ / std::max(sample_ns, 1.0), 0.5, 1.0);
+            double queue_size = std::sqrt(estimated_limit_);
+            new_limit = estimated_limit_ * gradient + queue_size;
+        }
+
+        new_limit = estimated_limit_ * (1.0 - options_.smoothing) + new_limit * options_.smoothing;
+        estimated_limit_ = std::clamp(new_limit,
+                                      static_cast<double>(options_.min_limit),
+                                      static_cast<double>(options_.max_limit));
+        limit_.store(static_cast<int>(estimated_limit_), std::memory_order_relaxed);
+    }
+
+    if (queued_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slot_available_.notify_one();
+    }
+}
@@ -0,0 +1,57 @@
+#include "core/health_watcher.hpp"
+#include "core/backend_streams.hpp"
+#include "proto/health.grpc.pb.h"
+
+using grpc::health::v1::HealthCheckResponse;
+
+// The broken call plus two failed reconnects (about 1.5 s with the default
+// backoff), which gives the channel itself time for a reconnect attempt
+static const int FAILURES_BEFORE_DOWN = 3;
+
+struct HealthWatchRpc {
+    using Stub = grpc::health::v1::Health::Stub;
+    using Request = grpc::health::v1::HealthCheckRequest;
+    using Response = HealthCheckResponse;
+
+    static const char* name() { return "Health watch"; }
+    static std::unique_ptr<Stub> newStub(const std::shared_ptr<grpc::Channel>& channel) {
+        return grpc::health::v1::Health::NewStub(channel);
+    }
+    static void start(Stub& stub, grpc::ClientContext* context, const Request* request,
+                      grpc::ClientReadReactor<Response>* reactor) {
+        stub.async()->Watch(context, request, reactor);
+    }
+};
+
+HealthWatcher::HealthWatcher(const Options& options, Callback on_change)
+    : on_change_(std::move(on_change)) {
+    if (!options.enabled) {
+        return;
+    }
+    BackendStreams<HealthWatchRpc>::Handlers handlers;
+    handlers.on_message = [this](Server& server, const HealthCheckResponse& response) {
+        on_change_(server, response.status() == HealthCheckResponse::SERVING);
+    };
+    handlers.on_failure = [this](Server& server, const grpc::Status& status, int failures) {
+        if (status.error_code() != grpc::StatusCode::CANCELLED && failures >= FAILURES_BEFORE_DOWN) {
+            on_change_(server, false);
+        }
+    };
+    streams_ = std::make_unique<BackendStreams<HealthWatchRpc>>(BackendStreams<HealthWatchRpc>::Options(),
+                                                                grpc::health::v1::HealthCheckRequest(),
+                                                                std::move(handlers));
+}
+
+HealthWatcher::~HealthWatcher() = default;
+
+void HealthWatcher::watch(const std::shared_ptr<Server>& server) {
+    if (streams_) {
+        streams_->watch(server);
+    }
+}
+
+void HealthWatcher::unwatch(const std::string& id) {
+    if (streams_) {
+        streams_->unwatch(id);
+    }
+}
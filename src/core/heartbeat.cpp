@@ -0,0 +1,60 @@
+#include "core/heartbeat.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+std::unique_ptr<HeartbeatPublisher> HeartbeatPublisher::fromEnvironment() {
+#ifdef __linux__
+    const char* value = std::getenv(HEARTBEAT_FD_ENV);
+    if (!value) {
+        return nullptr;
+    }
+    int fd = std::atoi(value);
+    void* addr = mmap(nullptr, sizeof(HeartbeatPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping outlives the fd
+    close(fd);
+    if (addr == MAP_FAILED) {
+        std::cerr << "Could not map heartbeat page from fd " << fd << ": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    return std::unique_ptr<HeartbeatPublisher>(new HeartbeatPublisher(static_cast<HeartbeatPage*>(addr)));
+#else
+    return nullptr;
+#endif
+}
+
+HeartbeatPublisher::HeartbeatPublisher(HeartbeatPage* page)
+    : page_(page) {
+    page_->beats.fetch_add(1, std::memory_order_relaxed);
+    page_->magic.store(HeartbeatPage::MAGIC, std::memory_order_release);
+    thread_ = std::thread(&HeartbeatPublisher::run, this);
+}
+
+HeartbeatPublisher::~HeartbeatPublisher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    stop_cv_.notify_all();
+    thread_.join();
+    page_->magic.store(0, std::memory_order_release);
+#ifdef __linux__
+    munmap(page_, sizeof(HeartbeatPage));
+#endif
+}
+
+void HeartbeatPublisher::run() {
+    auto interval = std::chrono::milliseconds(std::max<uint32_t>(1, page_->interval_ms.load(std::memory_order_relaxed)));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_cv_.wait_for(lock, interval, [this] { return stopping_; })) {
+        page_->beats.fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,196 @@
+#include "core/heartbeat_monitor.hpp"
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+HeartbeatMonitor::HeartbeatMonitor(const Options& options, Callback on_change)
+    : options_(options)
+    , on_change_(std::move(on_change)) {
+#ifdef __linux__
+    if (isEnabled()) {
+        thread_ = std::thread(&HeartbeatMonitor::run, this);
+    }
+#endif
+}
+
+HeartbeatMonitor::~HeartbeatMonitor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    for (auto& entry : entries_) {
+        release(entry.second);
+    }
+}
+
+int HeartbeatMonitor::createPage(const std::string& id) {
+#ifdef __linux__
+    if (!isEnabled()) {
+        return -1;
+    }
+    int fd = memfd_create(("lb-heartbeat-" + id).c_str(), MFD_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "memfd_create failed, no heartbeat for " << id << ": " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+    void* addr = MAP_FAILED;
+    if (ftruncate(fd, sizeof(HeartbeatPage)) == 0) {
+        addr = mmap(nullptr, sizeof(HeartbeatPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (addr == MAP_FAILED) {
+        std::cerr << "Could not map heartbeat page for " << id << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+
+    Entry entry;
+    entry.page = new (addr) HeartbeatPage();
+    entry.page->interval_ms.store(static_cast<uint32_t>(options_.beat_interval.count()), std::memory_order_relaxed);
+    entry.fd = fd;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(id);
+    if (it != entries_.end()) {
+        release(it->second);
+    }
+    entries_[id] = entry;
+    return fd;
+#else
+    return -1;
+#endif
+}
+
+void HeartbeatMonitor::watch(const std::shared_ptr<Server>& server) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(server->getId());
+    if (it == entries_.end()) {
+        return;
+    }
+    Entry& entry = it->second;
+#ifdef __linux__
+    // The backend has its own copy now
+    close(entry.fd);
+#endif
+    entry.fd = -1;
+    entry.server = server;
+    entry.last_beat_time = entry.last_progress_time = Clock::now();
+}
+
+void HeartbeatMonitor::unwatch(const std::string& id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return;
+    }
+    release(it->second);
+    entries_.erase(it);
+}
+
+void HeartbeatMonitor::release(Entry& entry) {
+#ifdef __linux__
+    if (entry.page) {
+        munmap(entry.page, sizeof(HeartbeatPage));
+    }
+    if (entry.fd >= 0) {
+        close(entry.fd);
+    }
+#endif
+    entry.page = nullptr;
+    entry.fd = -1;
+}
+
+bool HeartbeatMonitor::check(Entry& entry, Server& server, Clock::time_point now) {
+    const HeartbeatPage& page = *entry.page;
+    bool attached = page.magic.load(std::memory_order_acquire) == HeartbeatPage::MAGIC;
+    uint64_t beats = page.beats.load(std::memory_order_relaxed);
+    uint64_t completed = page.completed.load(std::memory_order_relaxed);
+    uint32_t in_flight = page.in_flight.load(std::memory_order_relaxed);
+    uint32_t queue_depth = page.queue_depth.load(std::memory_order_relaxed);
+
+    if (!entry.attached) {
+        if (!attached) {
+            return true;  // still starting up; the other health checks cover that
+        }
+        entry.attached = true;
+        entry.last_beats = beats;
+        entry.last_completed = completed;
+        entry.last_beat_time = entry.last_progress_time = now;
+    }
+    if (!attached) {
+        return false;  // shutting down
+    }
+
+    if (beats != entry.last_beats) {
+        entry.last_beats = beats;
+        entry.last_beat_time = now;
+    }
+    if (completed != entry.last_completed || in_flight == 0) {
+        entry.last_completed = completed;
+        entry.last_progress_time = now;
+    }
+    if (in_flight != server.getBackendInFlight() || queue_depth != server.getBackendQueueDepth()) {
+        server.setBackendLoad(in_flight, queue_depth);
+    }
+
+    bool stalled = now - entry.last_beat_time > options_.stall_timeout;
+    bool wedged = now - entry.last_progress_time > options_.wedge_timeout;
+    if (entry.serving && (stalled || wedged)) {
+        std::cerr << "Backend " << server.getId()
+                  << (stalled ? " stopped beating" : " is not completing any of its requests") << std::endl;
+    }
+    return !stalled && !wedged;
+}
+
+void HeartbeatMonitor::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto last_run = Clock::now();
+    while (!stopping_) {
+        cv_.wait_for(lock, options_.beat_interval, [this] { return stopping_; });
+        if (stopping_) {
+            break;
+        }
+
+        auto now = Clock::now();
+        // If this thread was held up itself, silence on a page says nothing
+        // about the backend
+        bool late = now - last_run > options_.stall_timeout;
+        last_run = now;
+
+        std::vector<std::pair<std::shared_ptr<Server>, bool>> changes;
+        for (auto& item : entries_) {
+            Entry& entry = item.second;
+            auto server = entry.server.lock();
+            if (!server) {
+                continue;  // not spawned yet
+            }
+            if (late) {
+                entry.last_beat_time = now;
+            }
+            bool serving = check(entry, *server, now);
+            if (serving != entry.serving) {
+                entry.serving = serving;
+                changes.emplace_back(std::move(server), serving);
+            }
+        }
+
+        if (!changes.empty()) {
+            lock.unlock();
+            for (auto& change : changes) {
+                on_change_(*change.first, change.second);
+            }
+            lock.lock();
+        }
+    }
+}
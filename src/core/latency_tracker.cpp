@@ -0,0 +1,41 @@
+#include "core/latency_tracker.hpp"
+#include <algorithm>
+#include <cmath>
+
+static int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LatencyTracker::record(std::chrono::microseconds latency) {
+    double sample = std::log(std::max<double>(static_cast<double>(latency.count()), 1.0) / 1000.0);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    double weight = weight_.load(std::memory_order_relaxed);
+    if (weight == 0.0) {
+        mean_.store(sample, std::memory_order_relaxed);
+        variance_.store(1.0, std::memory_order_relaxed);
+    } else {
+        // West's incremental update for an exponentially weighted mean/variance
+        double mean = mean_.load(std::memory_order_relaxed);
+        double diff = sample - mean;
+        double increment = kSmoothing * diff;
+        mean_.store(mean + increment, std::memory_order_relaxed);
+        double variance = (1.0 - kSmoothing) * (variance_.load(std::memory_order_relaxed) + diff * increment);
+        variance_.store(std::max(variance, kMinVariance), std::memory_order_relaxed);
+    }
+    weight_.store(weight * (1.0 - kSmoothing) + 1.0, std::memory_order_relaxed);
+    last_update_ns_.store(steadyNowNs(), std::memory_order_relaxed);
+}
+
+LatencyTracker::Estimate LatencyTracker::getEstimate() const {
+    Estimate estimate;
+    estimate.mean = mean_.load(std::memory_order_relaxed);
+    estimate.variance = variance_.load(std::memory_order_relaxed);
+    estimate.weight = weight_.load(std::memory_order_relaxed);
+    if (estimate.weight > 0.0) {
+        double idle_seconds = (steadyNowNs() - last_update_ns_.load(std::memory_order_relaxed)) / 1e9;
+        estimate.weight *= std::exp2(-std::max(idle_seconds, 0.0) / kIdleHalfLifeSeconds);
+    }
+    return estimate;
+}
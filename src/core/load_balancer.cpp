@@ -1,38 +1,148 @@
-#include "core/load_balancer.hpp"
-#include <grpcpp/grpcpp.h>
-
-LoadBalancerService::LoadBalancerService(
-    std::shared_ptr<ServerManager> server_manager,
-    std::shared_ptr<Strategy> strategy)
-    : server_manager_(server_manager)
-    , strategy_(strategy) {}
-
-grpc::Status LoadBalancerService::HandleRequest( grpc::ServerContext* context, const loadbalancer::Request* request, loadbalancer::Response* response) {
-    auto servers = server_manager_->getActiveServers();
-    auto selected_server = strategy_->selectServer(servers, *request);
-
-    if (!selected_server) {
-        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "No servers available");
-    }
-
-    selected_server->incrementRequestCount();
-    
-    // Create client and forward request to selected server
-    std::string server_address = selected_server->getAddress() + ":" + std::to_string(selected_server->getPort());
-    
-    auto channel = grpc::CreateChannel(server_address, grpc::InsecureChannelCredentials());
-    auto stub = loadbalancer::LoadBalancerService::NewStub(channel);
-
-    grpc::ClientContext client_context;
-    loadbalancer::Response server_response;
-
-    auto status = stub->HandleRequest(&client_context, *request, &server_response);
-    
-    if (status.ok()) {
-        response->set_message(server_response.message());
-        response->set_server_id(selected_server->getId());
-        return grpc::Status::OK;
-    }
-
-    return status;
-}
\ No newline at end of file
+#include "core/load_balancer.hpp"
+#include "utils/random.hpp"
+#include <chrono>
+#include <grpcpp/grpcpp.h>
+
+template class LoadBalancerServiceT<RoundRobinStrategy>;
+template class LoadBalancerServiceT<PerWorkerRoundRobinStrategy>;
+template class LoadBalancerServiceT<LeastConnectionsStrategy>;
+template class LoadBalancerServiceT<LeastOutstandingRequestsStrategy>;
+template class LoadBalancerServiceT<ResourceBasedStrategy>;
+template class LoadBalancerServiceT<JoinIdleQueueStrategy>;
+
+// Whether a call counts for or against the backend in outlier detection;
+// returns false for outcomes that say nothing about it. Like cancellation,
+// DEADLINE_EXCEEDED comes from the caller's deadline (the backend call has
+// none of its own), so a client with a tight budget can't get a healthy
+// backend ejected.
+static bool classifyForOutlierDetection(const grpc::Status& status, bool& success) {
+    switch (status.error_code()) {
+        case grpc::StatusCode::CANCELLED:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+            return false;
+        case grpc::StatusCode::UNKNOWN:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        case grpc::StatusCode::INTERNAL:
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DATA_LOSS:
+            success = false;
+            return true;
+        default:
+            success = true;
+            return true;
+    }
+}
+
+LoadBalancerServiceBase::LoadBalancerServiceBase(std::shared_ptr<ServerManager> server_manager)
+    : server_manager_(std::move(server_manager)) {}
+
+// The backend call carries no deadline of its own, only the caller's, so
+// DEADLINE_EXCEEDED says how patient the client was rather than how loaded
+// the backend is and must not shrink the limit.
+static ConcurrencyLimiter::Outcome classifyForLimiter(const grpc::Status& status) {
+    switch (status.error_code()) {
+        case grpc::StatusCode::OK:
+            return ConcurrencyLimiter::Outcome::Success;
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        case grpc::StatusCode::UNAVAILABLE:
+            return ConcurrencyLimiter::Outcome::Dropped;
+        default:
+            return ConcurrencyLimiter::Outcome::Ignored;
+    }
+}
+
+ConcurrencyLimiter::Permit LoadBalancerServiceBase::admit(ServerSpan servers, Server*& selected_server) {
+    auto permit = selected_server->getLimiter().tryAcquire();
+    if (permit) {
+        return permit;
+    }
+
+    // Start at a random offset so rerouted load doesn't all land on one server
+    size_t offset = fastRandomBelow(servers.size());
+    for (size_t i = 0; i < servers.size(); ++i) {
+        Server* candidate = servers[(offset + i) % servers.size()].get();
+        if (candidate == selected_server || !candidate->isHealthy()) {
+            continue;
+        }
+        permit = candidate->getLimiter().tryAcquire();
+        if (permit) {
+            selected_server = candidate;
+            return permit;
+        }
+    }
+
+    return selected_server->getLimiter().acquire();
+}
+
+grpc::Status LoadBalancerServiceBase::forward(grpc::ServerContext* context, Server& selected_server, ConcurrencyLimiter::Permit& permit, const loadbalancer::Request* request, loadbalancer::Response* response, std::chrono::microseconds& latency) {
+    selected_server.incrementRequestCount();
+    ActiveConnectionGuard in_flight(selected_server);
+    
+    // Forward request to selected server over its cached channel
+    auto stub = loadbalancer::LoadBalancerService::NewStub(selected_server.getChannel());
+
+    // Propagates the caller's deadline and cancellation to the backend call
+    auto client_context = grpc::ClientContext::FromServerContext(*context);
+    loadbalancer::Response server_response;
+
+    auto start = std::chrono::steady_clock::now();
+    auto status = stub->HandleRequest(client_context.get(), *request, &server_response);
+    latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    permit.setOutcome(classifyForLimiter(status));
+
+    bool success;
+    if (classifyForOutlierDetection(status, success)) {
+        server_manager_->recordRequestOutcome(selected_server, success, latency);
+    }
+    
+    if (status.ok()) {
+        selected_server.getLatencyTracker().record(latency);
+        response->set_message(server_response.message());
+        response->set_server_id(selected_server.getId());
+        return grpc::Status::OK;
+    }
+
+    return status;
+}
+
+LoadBalancerService::LoadBalancerService(
+    std::shared_ptr<ServerManager> server_manager,
+    std::shared_ptr<StrategyManager> strategy_manager)
+    : LoadBalancerServiceBase(std::move(server_manager))
+    , strategy_manager_(std::move(strategy_manager)) {}
+
+grpc::Status LoadBalancerService::HandleRequest( grpc::ServerContext* context, const loadbalancer::Request* request, loadbalancer::Response* response) {
+    // Hold our own reference so a concurrent SetStrategy cannot free it mid-selection
+    auto strategy = strategy_manager_->getStrategy();
+    return dispatch(context, request, response,
+        [&strategy, request](ServerSpan servers) {
+            return strategy->selectIndex(servers, *request);
+        },
+        [&strategy](Server& server, std::chrono::microseconds latency, bool success) {
+            strategy->onRequestFinished(server, latency, success);
+        });
+}
+
+std::unique_ptr<loadbalancer::LoadBalancerService::Service> createSpecializedService(
+    const std::string& strategy_name,
+    std::shared_ptr<ServerManager> server_manager) {
+    if (strategy_name == "round_robin") {
+        return std::make_unique<LoadBalancerServiceT<RoundRobinStrategy>>(std::move(server_manager));
+    }
+    if (strategy_name == "round_robin_per_worker") {
+        return std::make_unique<LoadBalancerServiceT<PerWorkerRoundRobinStrategy>>(std::move(server_manager));
+    }
+    if (strategy_name == "least_connections") {
+        return std::make_unique<LoadBalancerServiceT<LeastConnectionsStrategy>>(std::move(server_manager));
+    }
+    if (strategy_name == "least_outstanding_requests") {
+        return std::make_unique<LoadBalancerServiceT<LeastOutstandingRequestsStrategy>>(std::move(server_manager));
+    }
+    if (strategy_name == "resource_based") {
+        return std::make_unique<LoadBalancerServiceT<ResourceBasedStrategy>>(std::move(server_manager));
+    }
+    if (strategy_name == "join_idle_queue") {
+        return std::make_unique<LoadBalancerServiceT<JoinIdleQueueStrategy>>(std::move(server_manager));
+    }
+    return nullptr;
+}
@@ -0,0 +1,53 @@
+#include "core/metrics_streamer.hpp"
+#include "core/backend_streams.hpp"
+#include "proto/admin_service.grpc.pb.h"
+
+struct MetricsRpc {
+    using Stub = admin::AdminService::Stub;
+    using Request = admin::StreamMetricsRequest;
+    using Response = admin::MetricsSample;
+
+    static const char* name() { return "Metrics stream"; }
+    static std::unique_ptr<Stub> newStub(const std::shared_ptr<grpc::Channel>& channel) {
+        return admin::AdminService::NewStub(channel);
+    }
+    static void start(Stub& stub, grpc::ClientContext* context, const Request* request,
+                      grpc::ClientReadReactor<Response>* reactor) {
+        stub.async()->StreamMetrics(context, request, reactor);
+    }
+};
+
+MetricsStreamer::MetricsStreamer(const Options& options) {
+    if (options.interval.count() <= 0) {
+        return;
+    }
+    admin::StreamMetricsRequest request;
+    request.set_interval_ms(static_cast<uint32_t>(options.interval.count()));
+    request.set_min_change(options.min_change);
+    request.set_max_silence_ms(static_cast<uint32_t>(options.max_silence.count()));
+
+    BackendStreams<MetricsRpc>::Handlers handlers;
+    handlers.on_message = [](Server& server, const admin::MetricsSample& sample) {
+        server.setCPUUsage(sample.cpu_usage());
+        server.setMemoryUsage(sample.memory_usage());
+        server.setBackendLoad(sample.in_flight(), sample.queue_depth());
+    };
+    // Polling by the health checker covers the gap until it is back
+    handlers.on_failure = [](Server&, const grpc::Status&, int) {};
+    streams_ = std::make_unique<BackendStreams<MetricsRpc>>(BackendStreams<MetricsRpc>::Options(),
+                                                            std::move(request), std::move(handlers));
+}
+
+MetricsStreamer::~MetricsStreamer() = default;
+
+void MetricsStreamer::watch(const std::shared_ptr<Server>& server) {
+    if (streams_) {
+        streams_->watch(server);
+    }
+}
+
+void MetricsStreamer::unwatch(const std::string& id) {
+    if (streams_) {
+        streams_->unwatch(id);
+    }
+}
@@ -0,0 +1,166 @@
+#include "core/outlier_detector.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <utility>
+
+// Floor on the pool's latency spread, as a fraction of its mean, so a pool
+// of near-identical servers doesn't eject one over a few microseconds
+static const double MIN_LATENCY_SPREAD = 0.1;
+
+int OutlierStats::record(bool success, std::chrono::microseconds latency) {
+    auto& bucket = buckets_[current_.load(std::memory_order_relaxed)];
+    if (success) {
+        bucket.successes.fetch_add(1, std::memory_order_relaxed);
+        bucket.latency_us.fetch_add(static_cast<uint64_t>(latency.count()), std::memory_order_relaxed);
+        consecutive_failures_.store(0, std::memory_order_relaxed);
+        return 0;
+    }
+    bucket.failures.fetch_add(1, std::memory_order_relaxed);
+    return consecutive_failures_.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+OutlierStats::Totals OutlierStats::getTotals() const {
+    Totals totals;
+    for (const auto& bucket : buckets_) {
+        totals.successes += bucket.successes.load(std::memory_order_relaxed);
+        totals.failures += bucket.failures.load(std::memory_order_relaxed);
+        totals.latency_us += bucket.latency_us.load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+void OutlierStats::advance() {
+    size_t next = (current_.load(std::memory_order_relaxed) + 1) % kBuckets;
+    buckets_[next].successes.store(0, std::memory_order_relaxed);
+    buckets_[next].failures.store(0, std::memory_order_relaxed);
+    buckets_[next].latency_us.store(0, std::memory_order_relaxed);
+    current_.store(next, std::memory_order_relaxed);
+}
+
+OutlierDetector::OutlierDetector(const Options& options)
+    : options_(options) {}
+
+bool OutlierDetector::record(Server& server, bool success, std::chrono::microseconds latency) {
+    int consecutive = server.getOutlierStats().record(success, latency);
+    return options_.consecutive_failures > 0 && consecutive >= options_.consecutive_failures;
+}
+
+bool OutlierDetector::isAnalysisDue() {
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t due = next_analysis_ns_.load(std::memory_order_relaxed);
+    if (now < due) {
+        return false;
+    }
+    int64_t next = now + std::chrono::duration_cast<std::chrono::nanoseconds>(options_.interval).count();
+    return next_analysis_ns_.compare_exchange_strong(due, next, std::memory_order_relaxed);
+}
+
+bool OutlierDetector::canEject(const std::vector<std::shared_ptr<Server>>& servers) const {
+    size_t healthy = 0;
+    size_t ejected = 0;
+    for (const auto& srv : servers) {
+        if (!srv->isHealthy()) continue;
+        healthy++;
+        if (srv->isEjected()) ejected++;
+    }
+    // Never eject the last routable server, even at 100%
+    size_t allowed = healthy * static_cast<size_t>(options_.max_ejection_percent) / 100;
+    return ejected + 1 <= allowed && ejected + 1 < healthy;
+}
+
+bool OutlierDetector::eject(Server& server, const std::vector<std::shared_ptr<Server>>& servers, const std::string& reason) {
+    auto& stats = server.getOutlierStats();
+    if (stats.isEjected() || !canEject(servers)) {
+        return false;
+    }
+
+    std::chrono::milliseconds duration = options_.base_ejection_time * (int64_t{1} << std::min(stats.ejection_multiplier_, 20));
+    duration = std::min(duration, options_.max_ejection_time);
+    stats.ejection_multiplier_++;
+    stats.ejected_until_ = std::chrono::steady_clock::now() + duration;
+    stats.ejected_.store(true, std::memory_order_release);
+    // A fresh streak is needed to trip the threshold again
+    stats.consecutive_failures_.store(0, std::memory_order_relaxed);
+
+    std::cout << "Ejecting server " << server.getId() << " for " << duration.count()
+              << " ms (" << reason << ")" << std::endl;
+    return true;
+}
+
+bool OutlierDetector::analyze(const std::vector<std::shared_ptr<Server>>& servers) {
+    auto now = std::chrono::steady_clock::now();
+    bool changed = false;
+
+    struct Candidate {
+        Server* server;
+        OutlierStats::Totals totals;
+    };
+    std::vector<Candidate> candidates;
+
+    for (const auto& srv : servers) {
+        auto& stats = srv->getOutlierStats();
+        if (stats.isEjected()) {
+            if (now >= stats.ejected_until_) {
+                stats.ejected_.store(false, std::memory_order_release);
+                stats.consecutive_failures_.store(0, std::memory_order_relaxed);
+                std::cout << "Readmitting server " << srv->getId() << std::endl;
+                changed = true;
+            }
+        } else if (stats.ejection_multiplier_ > 0 && now >= stats.ejected_until_ + options_.base_ejection_time) {
+            // Each base ejection time spent back in rotation halves the next ejection
+            stats.ejection_multiplier_--;
+            stats.ejected_until_ = now;
+        }
+
+        auto totals = stats.getTotals();
+        stats.advance();
+        if (srv->isHealthy() && !stats.isEjected() && totals.requests() >= options_.min_requests) {
+            candidates.push_back({srv.get(), totals});
+        }
+    }
+
+    for (const auto& c : candidates) {
+        double failure_rate = static_cast<double>(c.totals.failures) / c.totals.requests();
+        if (failure_rate >= options_.failure_rate_threshold) {
+            changed |= eject(*c.server, servers, "failure rate " + std::to_string(failure_rate));
+        }
+    }
+
+    if (options_.latency_stdev_factor <= 0.0) {
+        return changed;
+    }
+    std::vector<std::pair<Server*, double>> means;
+    for (const auto& c : candidates) {
+        if (c.totals.successes > 0) {
+            means.emplace_back(c.server, static_cast<double>(c.totals.latency_us) / c.totals.successes);
+        }
+    }
+    // Latency outliers need a population to compare against
+    if (means.size() < 3) {
+        return changed;
+    }
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    for (const auto& m : means) {
+        sum += m.second;
+        sum_squares += m.second * m.second;
+    }
+
+    // Each server is compared against the rest of the pool, leaving itself
+    // out: with itself included its z-score can never exceed sqrt(n - 1),
+    // which for small pools is below any useful factor
+    size_t others = means.size() - 1;
+    for (const auto& m : means) {
+        double mean = (sum - m.second) / others;
+        double variance = std::max(0.0, (sum_squares - m.second * m.second) / others - mean * mean);
+        double stdev = std::max(std::sqrt(variance), MIN_LATENCY_SPREAD * mean);
+        if (m.second > mean + options_.latency_stdev_factor * stdev) {
+            changed |= eject(*m.first, servers,
+                  "mean latency " + std::to_string(static_cast<int64_t>(m.second)) + " us vs pool "
+                  + std::to_string(static_cast<int64_t>(mean)) + " us");
+        }
+    }
+    return changed;
+}
@@ -1,77 +1,184 @@
-#include "core/process/linux_process.hpp"
-#include <unistd.h>
-#include <sys/wait.h>
-#include <signal.h>
-#include <errno.h>
-
-LinuxProcess::LinuxProcess()
-    : pid_(-1){}
-
-LinuxProcess::~LinuxProcess(){
-    if (pid_ > 0) {
-        kill(pid_, SIGTERM);
-    }
-    int status = 0;
-    waitpid(pid_, &status, 0);
-    pid_ = -1;
-}
-
-bool LinuxProcess::start(const std::string& command){
-    pid_ = fork();
-    if (pid_ < 0) {
-        return false;
-    }
-
-    if (pid_ == 0) {
-        execl("/bin/sh", "sh", "-c", command.c_str(), (char*)nullptr);
-        _exit(127);
-    }
-
-    return true;
-}
-
-bool LinuxProcess::isRunning(){
-    if (pid_ <= 0) {
-        return false;
-    }
-
-    int status = 0;
-    pid_t result = waitpid(pid_, &status, WNOHANG);
-    if (result == 0) {
-        return true;
-    } else if (result == pid_) {
-        return false;
-    } else {
-        return false;
-    }
-}
-
-void LinuxProcess::terminate(){
-    if (pid_ > 0) {
-        kill(pid_, SIGTERM);
-    }
-}
-
-int LinuxProcess::getExitCode(){
-    if (pid_ <= 0) {
-        return -1;
-    }
-
-    int status = 0;
-    pid_t result = waitpid(pid_, &status, WNOHANG);
-    if (result == pid_) {
-        if (WIFEXITED(status)) {
-            return WEXITSTATUS(status);
-        }
-        return -1;
-    }
-    return -1;
-}
-
-double LinuxProcess::getCPUUsage(){
-    return 0.0;
-}
-
-double LinuxProcess::getMemoryUsage(){
-    return 0.0;
-}
+#include "core/process/linux_process.hpp"
+#include "core/heartbeat.hpp"
+#include "utils/cgroup.hpp"
+#include "utils/numa_topology.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <linux/mempolicy.h>
+#include <signal.h>
+#include <errno.h>
+
+#ifndef SYS_pidfd_open
+    #define SYS_pidfd_open 434  // same number on every architecture
+#endif
+
+LinuxProcess::LinuxProcess()
+    : pid_(-1)
+    , sample_(ProcSampler::getInstance().track(getpid())){}
+
+LinuxProcess::~LinuxProcess(){
+    if (pid_ > 0 && !reap()) {
+        kill(pid_, SIGTERM);
+        int status = 0;
+        waitpid(pid_, &status, 0);
+    }
+    if (pidfd_ >= 0) {
+        close(pidfd_);
+    }
+    pid_ = -1;
+    CgroupTree::removeLeaf(cgroup_path_);
+}
+
+bool LinuxProcess::start(const std::string& command){
+    // Build the CPU and memory masks before forking; the child only makes syscalls
+    const auto& topology = NumaTopology::getInstance();
+    bool bind_numa = topology.getNodeCount() > 1 && topology.hasCpus(numa_node_)
+                     && numa_node_ < static_cast<int>(sizeof(unsigned long) * 8);
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    unsigned long node_mask = 0;
+    if (bind_numa) {
+        for (int cpu : topology.getCpus(numa_node_)) {
+            CPU_SET(cpu, &cpus);
+        }
+        node_mask = 1UL << numa_node_;
+    }
+
+    // The environment is set through the shell; setenv isn't safe after fork
+    std::string shell_command = command;
+    if (heartbeat_fd_ >= 0) {
+        shell_command = std::string(HEARTBEAT_FD_ENV) + "=" + std::to_string(heartbeat_fd_) + " " + command;
+    }
+
+    // Opened up front too; the child joins the cgroup by writing "0" (itself).
+    // If that fails it sends errno back through join_pipe, whose write end
+    // closes on exec, so the parent knows which way to sample it.
+    int cgroup_fd = -1;
+    int join_pipe[2] = {-1, -1};
+    if (!cgroup_path_.empty()) {
+        cgroup_fd = open((cgroup_path_ + "/cgroup.procs").c_str(), O_WRONLY | O_CLOEXEC);
+        if (cgroup_fd < 0) {
+            std::cerr << "Could not open " << cgroup_path_ << "/cgroup.procs: " << std::strerror(errno) << std::endl;
+        } else if (pipe2(join_pipe, O_CLOEXEC) != 0) {
+            std::cerr << "Could not create a pipe for joining " << cgroup_path_ << ": " << std::strerror(errno) << std::endl;
+            close(cgroup_fd);
+            cgroup_fd = -1;
+        }
+    }
+
+    pid_ = fork();
+    if (pid_ < 0) {
+        if (cgroup_fd >= 0) {
+            close(cgroup_fd);
+            close(join_pipe[0]);
+            close(join_pipe[1]);
+        }
+        return false;
+    }
+
+    if (pid_ == 0) {
+        // The page is created close-on-exec; only this child keeps it
+        if (heartbeat_fd_ >= 0) {
+            fcntl(heartbeat_fd_, F_SETFD, 0);
+        }
+        // Joining before exec means the backend never runs outside its cgroup
+        if (cgroup_fd >= 0 && write(cgroup_fd, "0", 1) != 1) {
+            int error = errno;
+            ssize_t ignored = write(join_pipe[1], &error, sizeof(error));
+            (void)ignored;
+        }
+        // Both policies are inherited across exec by the backend
+        if (bind_numa) {
+            sched_setaffinity(0, sizeof(cpus), &cpus);
+            syscall(SYS_set_mempolicy, MPOL_BIND, &node_mask, sizeof(node_mask) * 8);
+        }
+        execl("/bin/sh", "sh", "-c", shell_command.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+
+    // Needs Linux 5.3; without it exits are only noticed by polling.
+    // pidfds are always close-on-exec.
+    pidfd_ = static_cast<int>(syscall(SYS_pidfd_open, pid_, 0));
+
+    if (cgroup_fd >= 0) {
+        close(cgroup_fd);
+        close(join_pipe[1]);
+        // EOF once the child has exec'd (or exited) without reporting an error
+        int error = 0;
+        ssize_t got;
+        do {
+            got = read(join_pipe[0], &error, sizeof(error));
+        } while (got < 0 && errno == EINTR);
+        close(join_pipe[0]);
+        in_cgroup_ = got == 0;
+        if (got > 0) {
+            // Its leaf would read as idle; it runs in our cgroup, without its limits
+            std::cerr << "Backend " << pid_ << " could not join " << cgroup_path_ << ": " << std::strerror(error)
+                      << "; sampling it per process" << std::endl;
+        }
+    }
+    if (in_cgroup_) {
+        sample_ = ProcSampler::getInstance().trackCgroup(pid_, cgroup_path_);
+    } else {
+        sample_ = ProcSampler::getInstance().track(pid_);
+    }
+    return true;
+}
+
+bool LinuxProcess::reap(){
+    std::lock_guard<std::mutex> lock(reap_mutex_);
+    if (exited_ || pid_ <= 0) {
+        return exited_;
+    }
+
+    int status = 0;
+    pid_t result = waitpid(pid_, &status, WNOHANG);
+    if (result == pid_) {
+        exited_ = true;
+        exit_status_ = status;
+    } else if (result < 0 && errno == ECHILD) {
+        exited_ = true;
+    }
+    return exited_;
+}
+
+bool LinuxProcess::isRunning(){
+    return pid_ > 0 && !reap();
+}
+
+void LinuxProcess::terminate(){
+    if (pid_ > 0 && !reap()) {
+        kill(pid_, SIGTERM);
+    }
+}
+
+int LinuxProcess::getExitCode(){
+    if (pid_ <= 0 || !reap()) {
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(reap_mutex_);
+    if (WIFEXITED(exit_status_)) {
+        return WEXITSTATUS(exit_status_);
+    }
+    return -1;
+}
+
+double LinuxProcess::getCPUUsage(){
+    return sample_->cpu_usage.load(std::memory_order_relaxed);
+}
+
+double LinuxProcess::getMemoryUsage(){
+    return sample_->memory_mb.load(std::memory_order_relaxed);
+}
+
+double LinuxProcess::getCPUPressure(){
+    return sample_->cpu_pressure.load(std::memory_order_relaxed);
+}
+
+double LinuxProcess::getMemoryPressure(){
+    return sample_->memory_pressure.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,211 @@
+#include "core/process/proc_sampler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <fcntl.h>
+#include <unistd.h>
+
+static const auto SAMPLE_INTERVAL = std::chrono::milliseconds(1000);
+
+// Reads a small /proc or cgroup file into buf; false if the process (or
+// cgroup) is gone
+static bool readProcFile(const char* path, char* buf, size_t size) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    ssize_t n = read(fd, buf, size - 1);
+    close(fd);
+    if (n <= 0) {
+        return false;
+    }
+    buf[n] = '\0';
+    return true;
+}
+
+// utime + stime from /proc/<pid>/stat, in clock ticks. The command name
+// may itself contain spaces and parentheses, so fields are counted from
+// the last ')'.
+static bool parseCpuTicks(const char* stat, uint64_t& ticks) {
+    const char* p = std::strrchr(stat, ')');
+    if (!p) {
+        return false;
+    }
+    // Fields after the name start at "state" (field 3); utime is field 14
+    for (int field = 3; field < 14; ++field) {
+        p = std::strchr(p + 1, ' ');
+        if (!p) {
+            return false;
+        }
+    }
+    char* end;
+    uint64_t utime = std::strtoull(p + 1, &end, 10);
+    uint64_t stime = std::strtoull(end, &end, 10);
+    ticks = utime + stime;
+    return true;
+}
+
+// Value of `key` in a flat-keyed file such as cpu.stat ("usage_usec 123")
+static bool parseKeyedValue(const char* text, const char* key, uint64_t& value) {
+    size_t key_length = std::strlen(key);
+    for (const char* line = text; *line; ) {
+        if (std::strncmp(line, key, key_length) == 0 && line[key_length] == ' ') {
+            value = std::strtoull(line + key_length + 1, nullptr, 10);
+            return true;
+        }
+        const char* next = std::strchr(line, '\n');
+        if (!next) {
+            break;
+        }
+        line = next + 1;
+    }
+    return false;
+}
+
+// "some avg10=1.23 ..." from a PSI file
+static double parseSomeAvg10(const char* text) {
+    const char* avg = std::strstr(text, "avg10=");
+    return avg && std::strncmp(text, "some", 4) == 0 ? std::strtod(avg + 6, nullptr) : 0.0;
+}
+
+ProcSampler& ProcSampler::getInstance() {
+    // Never destroyed, like TimerService: the thread runs until exit
+    static ProcSampler* instance = new ProcSampler(SAMPLE_INTERVAL);
+    return *instance;
+}
+
+ProcSampler::ProcSampler(std::chrono::milliseconds interval)
+    : interval_(interval)
+    , ticks_per_second_(static_cast<double>(sysconf(_SC_CLK_TCK)))
+    , page_size_mb_(static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0))
+    , thread_(&ProcSampler::run, this) {}
+
+std::shared_ptr<const ProcSampler::Sample> ProcSampler::track(pid_t pid) {
+    Tracked tracked;
+    tracked.pid = pid;
+    return add(std::move(tracked));
+}
+
+std::shared_ptr<const ProcSampler::Sample> ProcSampler::trackCgroup(pid_t pid, const std::string& cgroup) {
+    Tracked tracked;
+    tracked.pid = pid;
+    tracked.cgroup = cgroup;
+    return add(std::move(tracked));
+}
+
+std::shared_ptr<const ProcSampler::Sample> ProcSampler::add(Tracked tracked) {
+    auto sample = std::make_shared<Sample>();
+    tracked.sample = sample;
+    std::lock_guard<std::mutex> lock(mutex_);
+    added_.push_back(std::move(tracked));
+    return sample;
+}
+
+void ProcSampler::sample(Tracked& tracked, std::chrono::steady_clock::time_point now) {
+    auto slot = tracked.sample.lock();
+    if (!slot) {
+        return;
+    }
+    if (!tracked.cgroup.empty()) {
+        sampleCgroup(tracked, *slot, now);
+        return;
+    }
+
+    char path[64];
+    char buf[1024];
+    uint64_t ticks = 0;
+    std::snprintf(path, sizeof(path), "/proc/%d/stat", static_cast<int>(tracked.pid));
+    if (!readProcFile(path, buf, sizeof(buf)) || !parseCpuTicks(buf, ticks)) {
+        // Exited (or not ours to read): report it as idle
+        slot->cpu_usage.store(0.0, std::memory_order_relaxed);
+        slot->memory_mb.store(0.0, std::memory_order_relaxed);
+        tracked.primed = false;
+        return;
+    }
+
+    if (tracked.primed) {
+        double elapsed = std::chrono::duration<double>(now - tracked.last_time).count();
+        if (elapsed > 0.0) {
+            double cpu_seconds = (ticks - std::min(ticks, tracked.last_ticks)) / ticks_per_second_;
+            slot->cpu_usage.store(cpu_seconds * 100.0 / elapsed, std::memory_order_relaxed);
+        }
+    }
+    tracked.last_ticks = ticks;
+    tracked.last_time = now;
+    tracked.primed = true;
+    sampleMemory(tracked.pid, *slot);
+}
+
+void ProcSampler::sampleMemory(pid_t pid, Sample& slot) {
+    // statm: size resident shared ... (in pages)
+    char path[64];
+    char buf[256];
+    std::snprintf(path, sizeof(path), "/proc/%d/statm", static_cast<int>(pid));
+    if (readProcFile(path, buf, sizeof(buf))) {
+        char* end;
+        std::strtoull(buf, &end, 10);
+        uint64_t resident = std::strtoull(end, &end, 10);
+        slot.memory_mb.store(resident * page_size_mb_, std::memory_order_relaxed);
+    }
+}
+
+void ProcSampler::sampleCgroup(Tracked& tracked, Sample& slot, std::chrono::steady_clock::time_point now) {
+    char buf[1024];
+    uint64_t usage_usec = 0;
+    // cpu.stat is there whether or not the cpu controller is enabled
+    if (!readProcFile((tracked.cgroup + "/cpu.stat").c_str(), buf, sizeof(buf))
+        || !parseKeyedValue(buf, "usage_usec", usage_usec)) {
+        slot.cpu_usage.store(0.0, std::memory_order_relaxed);
+        slot.memory_mb.store(0.0, std::memory_order_relaxed);
+        tracked.primed = false;
+        return;
+    }
+    if (tracked.primed) {
+        double elapsed = std::chrono::duration<double>(now - tracked.last_time).count();
+        if (elapsed > 0.0) {
+            double cpu_seconds = (usage_usec - std::min(usage_usec, tracked.last_ticks)) / 1e6;
+            slot.cpu_usage.store(cpu_seconds * 100.0 / elapsed, std::memory_order_relaxed);
+        }
+    }
+    tracked.last_ticks = usage_usec;
+    tracked.last_time = now;
+    tracked.primed = true;
+
+    // memory.current needs the memory controller; fall back to the
+    // backend's own RSS without it
+    if (readProcFile((tracked.cgroup + "/memory.current").c_str(), buf, sizeof(buf))) {
+        uint64_t bytes = std::strtoull(buf, nullptr, 10);
+        slot.memory_mb.store(bytes / (1024.0 * 1024.0), std::memory_order_relaxed);
+    } else {
+        sampleMemory(tracked.pid, slot);
+    }
+
+    // PSI files are missing on kernels built or booted without it
+    if (readProcFile((tracked.cgroup + "/cpu.pressure").c_str(), buf, sizeof(buf))) {
+        slot.cpu_pressure.store(parseSomeAvg10(buf), std::memory_order_relaxed);
+    }
+    if (readProcFile((tracked.cgroup + "/memory.pressure").c_str(), buf, sizeof(buf))) {
+        slot.memory_pressure.store(parseSomeAvg10(buf), std::memory_order_relaxed);
+    }
+}
+
+void ProcSampler::run() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::move(added_.begin(), added_.end(), std::back_inserter(tracked_));
+            added_.clear();
+        }
+        tracked_.erase(std::remove_if(tracked_.begin(), tracked_.end(),
+                                      [](const Tracked& t) { return t.sample.expired(); }),
+                       tracked_.end());
+
+        auto now = std::chrono::steady_clock::now();
+        for (auto& tracked : tracked_) {
+            sample(tracked, now);
+        }
+        std::this_thread::sleep_for(interval_);
+    }
+}
@@ -0,0 +1,132 @@
+#include "core/process_exit_monitor.hpp"
+#include <cstring>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+#endif
+
+static const int MAX_EVENTS = 64;
+static const uint64_t WAKE_KEY = 0;
+
+ProcessExitMonitor::ProcessExitMonitor(const Options& options, Callback on_exit)
+    : on_exit_(std::move(on_exit)) {
+#ifdef __linux__
+    if (!options.enabled) {
+        return;
+    }
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = WAKE_KEY;
+    if (epoll_fd_ < 0 || wake_fd_ < 0 || epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event) != 0) {
+        std::cerr << "Process exit monitor unavailable: " << std::strerror(errno) << std::endl;
+        if (epoll_fd_ >= 0) close(epoll_fd_);
+        if (wake_fd_ >= 0) close(wake_fd_);
+        epoll_fd_ = wake_fd_ = -1;
+        return;
+    }
+    thread_ = std::thread(&ProcessExitMonitor::run, this);
+#endif
+}
+
+ProcessExitMonitor::~ProcessExitMonitor() {
+#ifdef __linux__
+    if (!isEnabled()) {
+        return;
+    }
+    uint64_t one = 1;
+    ssize_t ignored = write(wake_fd_, &one, sizeof(one));
+    (void)ignored;
+    thread_.join();
+    close(wake_fd_);
+    close(epoll_fd_);
+#endif
+}
+
+bool ProcessExitMonitor::watch(const std::shared_ptr<Server>& server) {
+#ifdef __linux__
+    Process* process = server->getProcess();
+    int fd = process ? process->getExitFd() : -1;
+    if (!isEnabled() || fd < 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t key = next_key_++;
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = key;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+        std::cerr << "Could not watch " << server->getId() << " for exit: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    entries_[key] = {server->getId(), server, fd};
+    keys_[server->getId()] = key;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ProcessExitMonitor::unwatch(const std::string& id) {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = keys_.find(id);
+    if (key == keys_.end()) {
+        return;
+    }
+    auto entry = entries_.find(key->second);
+    // The process (and its fd) is still alive here, so this can't hit a
+    // reused descriptor
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, entry->second.fd, nullptr);
+    entries_.erase(entry);
+    keys_.erase(key);
+#endif
+}
+
+void ProcessExitMonitor::run() {
+#ifdef __linux__
+    epoll_event events[MAX_EVENTS];
+    while (true) {
+        int count = epoll_wait(epoll_fd_, events, MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "epoll_wait failed: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+        std::vector<std::shared_ptr<Server>> exited;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (int i = 0; i < count; ++i) {
+                uint64_t key = events[i].data.u64;
+                if (key == WAKE_KEY) {
+                    return;
+                }
+                auto entry = entries_.find(key);
+                if (entry == entries_.end()) {
+                    continue;  // unwatched since epoll_wait returned
+                }
+                epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, entry->second.fd, nullptr);
+                if (auto server = entry->second.server.lock()) {
+                    exited.push_back(std::move(server));
+                }
+                keys_.erase(entry->second.id);
+                entries_.erase(entry);
+            }
+        }
+        for (const auto& server : exited) {
+            on_exit_(*server);
+        }
+    }
+#endif
+}
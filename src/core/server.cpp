@@ -1,67 +1,141 @@
-#include "core/server.hpp"
-
-Server::Server(const std::string& host, int port)
-    : host_(host)
-    , port_(port)
-    , is_healthy_(true)
-    , last_health_check_time_(std::chrono::system_clock::now())
-{
-    id_ = host + ":" + std::to_string(port);
-}
-
-std::string Server::getAddress() const {
-    return host_;
-}
-
-int Server::getPort() const {
-    return port_;
-}
-
-std::string Server::getId() const {
-    return id_;
-}
-
-bool Server::isHealthy() const {
-    return is_healthy_;
-}
-
-void Server::setHealthStatus(bool status) {
-    is_healthy_ = status;
-    last_health_check_time_ = std::chrono::system_clock::now();
-}
-
-double Server::getCPUUsage() const {
-    return cpu_usage;
-}
-
-void Server::setCPUUsage(double usage) {
-    cpu_usage = usage;
-}
-
-double Server::getMemoryUsage() const {
-    return memory_usage;
-}
-
-void Server::setMemoryUsage(double usage) {
-    memory_usage = usage;
-}
-
-void Server::setLastHealthCheckTime(std::chrono::system_clock::time_point t) {
-    last_health_check_time_ = t;
-}
-
-std::chrono::system_clock::time_point Server::getLastHealthCheckTime() const {
-    return last_health_check_time_;
-}
-
-void Server::incrementActiveConnections() {
-    active_connections_.fetch_add(1, std::memory_order_relaxed);
-}
-
-void Server::decrementActiveConnections() {
-    active_connections_.fetch_sub(1, std::memory_order_relaxed);
-}
-
-int Server::getActiveConnections() const {
-    return active_connections_.load(std::memory_order_relaxed);
+#include "core/server.hpp"
+#include <algorithm>
+#include <functional>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+// The ramp factor moves in this many steps, each at least MIN_RAMP_STEP apart
+static const int RAMP_STEPS = 50;
+static const auto MIN_RAMP_STEP = std::chrono::milliseconds(20);
+
+Server::Server(const std::string& host, int port, const ConcurrencyLimiter::Options& limiter_options)
+    : host_(host)
+    , port_(port)
+    , is_healthy_(true)
+    , last_health_check_time_(std::chrono::system_clock::now())
+    , limiter_(limiter_options)
+{
+    id_ = host + ":" + std::to_string(port);
+    id_hash_ = std::hash<std::string>()(id_);
+}
+
+Server::~Server() {
+    if (ramp_timer_.load() != 0) {
+        TimerService::getInstance().cancel(ramp_timer_);
+    }
+}
+
+std::string Server::getAddress() const {
+    return host_;
+}
+
+int Server::getPort() const {
+    return port_;
+}
+
+std::string Server::getId() const {
+    return id_;
+}
+
+bool Server::isHealthy() const {
+    return is_healthy_.load(std::memory_order_relaxed);
+}
+
+void Server::setHealthStatus(bool status) {
+    is_healthy_.store(status, std::memory_order_relaxed);
+    last_health_check_time_.store(std::chrono::system_clock::now(), std::memory_order_relaxed);
+}
+
+// A backend in its own cgroup is measured by the kernel, which beats what
+// it reports about itself
+double Server::getCPUUsage() const {
+    if (process_ && process_->hasCgroupAccounting()) {
+        return process_->getCPUUsage();
+    }
+    return cpu_usage.load(std::memory_order_relaxed);
+}
+
+void Server::setCPUUsage(double usage) {
+    cpu_usage.store(usage, std::memory_order_relaxed);
+}
+
+double Server::getMemoryUsage() const {
+    if (process_ && process_->hasCgroupAccounting()) {
+        return process_->getMemoryUsage();
+    }
+    return memory_usage.load(std::memory_order_relaxed);
+}
+
+void Server::setMemoryUsage(double usage) {
+    memory_usage.store(usage, std::memory_order_relaxed);
+}
+
+void Server::setBackendLoad(uint32_t in_flight, uint32_t queue_depth) {
+    backend_in_flight_.store(in_flight, std::memory_order_relaxed);
+    backend_queue_depth_.store(queue_depth, std::memory_order_relaxed);
+}
+
+void Server::setLastHealthCheckTime(std::chrono::system_clock::time_point t) {
+    last_health_check_time_.store(t, std::memory_order_relaxed);
+}
+
+std::chrono::system_clock::time_point Server::getLastHealthCheckTime() const {
+    return last_health_check_time_.load(std::memory_order_relaxed);
+}
+
+void Server::incrementActiveConnections() {
+    active_connections_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Server::decrementActiveConnections() {
+    active_connections_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int Server::getActiveConnections() const {
+    return active_connections_.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<grpc::Channel> Server::getChannel() {
+    std::call_once(channel_once_, [this] {
+        channel_ = grpc::CreateChannel(host_ + ":" + std::to_string(port_), grpc::InsecureChannelCredentials());
+    });
+    return channel_;
+}
+
+admin::AdminService::Stub& Server::getAdminStub() {
+    std::call_once(admin_stub_once_, [this] {
+        admin_stub_ = admin::AdminService::NewStub(getChannel());
+    });
+    return *admin_stub_;
+}
+
+void Server::startRamp(const SlowStartPolicy& policy) {
+    if (ramp_timer_.load() != 0) {
+        TimerService::getInstance().cancel(ramp_timer_);
+    }
+    slow_start_ = policy;
+    ramp_start_ = std::chrono::steady_clock::now();
+    ramp_done_.store(!policy.isEnabled(), std::memory_order_release);
+    if (policy.isEnabled()) {
+        advanceRamp();
+    }
+}
+
+void Server::advanceRamp() {
+    double factor = slow_start_.factorAt(std::chrono::steady_clock::now() - ramp_start_);
+    ramp_factor_.store(factor, std::memory_order_relaxed);
+    if (factor >= 1.0) {
+        ramp_done_.store(true, std::memory_order_release);
+        ramp_timer_ = 0;
+        return;
+    }
+    auto step = std::max<std::chrono::steady_clock::duration>(slow_start_.window / RAMP_STEPS, MIN_RAMP_STEP);
+    ramp_timer_ = TimerService::getInstance().schedule(step, [this] { advanceRamp(); });
+}
+
+double Server::getRampFactor() const {
+    if (ramp_done_.load(std::memory_order_acquire)) {
+        return 1.0;
+    }
+    return ramp_factor_.load(std::memory_order_relaxed);
 }
\ No newline at end of file
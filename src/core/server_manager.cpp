@@ -1,132 +1,433 @@
-#include "core/server_manager.hpp"
-#include <windows.h>
-#include <process.h>
-#include "utils/config.hpp"
-#include <stdexcept>
-#include <string>
-#include <vector>
-
-static HANDLE CreateServerProcess(const std::string& command);
-
-ServerManager::ServerManager(const std::string& executable_path, int start_port, size_t min_servers, size_t max_servers)
-    : executable_path_(executable_path)
-    , next_port_(start_port)
-    , min_servers_(min_servers)
-    , max_servers_(max_servers) {
-    
-    for (size_t i = 0; i < min_servers_; ++i) {
-        addServer();
-    }
-}
-
-std::vector<std::shared_ptr<Server>> ServerManager::getAllServers() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return servers_;
-}
-
-std::shared_ptr<Server> ServerManager::findServerById(const std::string& id) {
-    //std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto& srv : servers_) {
-        if (srv->getId() == id) {
-            return srv;
-        }
-    }
-    return nullptr;
-}
-
-bool ServerManager::removeServerById(const std::string& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (active_servers <= min_servers_) {
-        return false;
-    }
-    for (auto it = servers_.begin(); it != servers_.end(); ++it) {
-        if ((*it)->getId() == id) {
-            if((*it)->getProcess() != nullptr) {
-                (*it)->getProcess()->terminate();
-            }
-            (*it)->setHealthStatus(false);
-            active_servers--;
-            return true;
-        }
-    }
-    return false;
-}
-
-std::shared_ptr<Server> ServerManager::addServer() {
-    if (active_servers >= max_servers_) {
-        return nullptr;
-    }
-    auto server = std::make_shared<Server>(server_address, next_port_);
-    std::string command = executable_path_ + " " + std::to_string(next_port_);
-    auto process = ProcessFactory::createProcess();
-    if (!process->start(command)) {
-        return nullptr;
-    }
-    server->setProcess(std::move(process));
-    servers_.push_back(server);
-    active_servers++;
-    next_port_++;
-    return server;
-}
-
-// int ServerManager::findAvailablePort() {
-//     // If we have available ports in our pool, use one
-//     if (!available_ports_.empty()) {
-//         int port = *available_ports_.begin();
-//         available_ports_.erase(available_ports_.begin());
-//         return port;
-//     }
-    
-//     // Otherwise, use the next_port_ if it's still within range
-//     if (next_port_ < start_port_ + max_port_range_) {
-//         int port = next_port_++;
-//         return port;
-//     }
-    
-//     return -1;
-// }
-
-void ServerManager::updateServerHealth(const std::string& id, bool isHealthy, double cpuUsage, double memoryUsage) {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto server = findServerById(id);
-    if (!server) {
-        return;
-    }
-    
-    //If a server dies unexpectedly (not through the health checker), 
-    //the active_servers counter in ServerManager can become inconsistent with the actual number of healthy servers
-    if(isHealthy && !server->isHealthy()) {
-        //it should never be the case that a server is unhealthy and not in the servers_ list, 
-        //as the server which goes offline never comes back online on same port,
-        //but we should check for it anyway
-        active_servers++;
-    } else if (!isHealthy && server->isHealthy()) {
-        active_servers--;
-    }
-    server->setHealthStatus(isHealthy);
-    server->setCPUUsage(cpuUsage);
-    server->setMemoryUsage(memoryUsage);
-}
-
-std::vector<std::shared_ptr<Server>> ServerManager::getActiveServers() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::vector<std::shared_ptr<Server>> active_servers;
-    for (const auto& srv : servers_) {
-        if (srv->isHealthy()) {
-            active_servers.push_back(srv);
-        }
-    }
-    return active_servers;
-}
-
-ServerManager::ServerStats ServerManager::getServerStats() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    ServerStats stats;
-    stats.total_servers = servers_.size();
-    stats.active_servers = active_servers;
-    stats.inactive_servers = servers_.size() - active_servers;
-    stats.min_servers = min_servers_;
-    stats.max_servers = max_servers_;
-    return stats;
+#include "core/server_manager.hpp"
+#include "utils/config.hpp"
+#include "utils/numa_topology.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// How long a server whose heartbeat stalled may stay out of rotation before
+// it gets a replacement
+static const auto STALL_REPLACE_GRACE = std::chrono::seconds(10);
+
+ServerManager::ServerManager(const std::string& executable_path, int start_port, size_t min_servers, size_t max_servers,
+                             const Options& options)
+    : executable_path_(executable_path)
+    , next_port_(start_port)
+    , min_servers_(min_servers)
+    , max_servers_(max_servers)
+    , options_(options)
+    , outlier_detector_(options.outlier_detection)
+    , snapshot_(std::make_shared<const ServerSnapshot>())
+    , metrics_streamer_(options.metrics_stream)
+    , health_watcher_(options.health_watch, [this](Server& server, bool serving) {
+          onServingChanged(server, serving);
+      })
+    , heartbeat_monitor_(options.heartbeat, [this](Server& server, bool serving) {
+          onHeartbeatChanged(server, serving);
+      })
+    , exit_monitor_(options.exit_monitor, [this](Server& server) {
+          onProcessExited(server);
+      }) {
+    
+    for (size_t i = 0; i < min_servers_; ++i) {
+        addServer();
+    }
+}
+
+ServerManager::~ServerManager() {
+    std::unordered_map<std::string, TimerService::TimerId> timers;
+    std::unordered_map<std::string, TimerService::TimerId> stall_timers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        timers.swap(drain_timers_);
+        stall_timers.swap(stall_timers_);
+    }
+    // Outside the lock: a running timeout callback takes it
+    for (const auto& entry : timers) {
+        TimerService::getInstance().cancel(entry.second);
+    }
+    for (const auto& entry : stall_timers) {
+        TimerService::getInstance().cancel(entry.second);
+    }
+}
+
+std::vector<std::shared_ptr<Server>> ServerManager::getAllServers() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return servers_;
+}
+
+std::shared_ptr<Server> ServerManager::findServerById(const std::string& id) {
+    //std::lock_guard<std::mutex> lock(mutex_);
+    auto it = servers_by_id_.find(id);
+    return it != servers_by_id_.end() ? it->second : nullptr;
+}
+
+bool ServerManager::removeServerById(const std::string& id) {
+    TimerService::TimerId stall_timer = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (active_servers <= min_servers_) {
+            return false;
+        }
+        auto it = std::find_if(servers_.begin(), servers_.end(),
+                               [&id](const std::shared_ptr<Server>& srv) { return srv->getId() == id; });
+        if (it == servers_.end()) {
+            return false;
+        }
+        // An exit we asked for needs no replacement
+        exit_monitor_.unwatch(id);
+        if((*it)->getProcess() != nullptr) {
+            (*it)->getProcess()->terminate();
+        }
+        // A stalled server already left the active count
+        if ((*it)->isHealthy()) {
+            active_servers--;
+        }
+        (*it)->setHealthStatus(false);
+        metrics_streamer_.unwatch(id);
+        health_watcher_.unwatch(id);
+        heartbeat_monitor_.unwatch(id);
+        registry_version_++;
+        publishSnapshot();
+        auto timer = stall_timers_.find(id);
+        if (timer != stall_timers_.end()) {
+            stall_timer = timer->second;
+            stall_timers_.erase(timer);
+        }
+    }
+    // Outside the lock: a running timeout callback takes it
+    if (stall_timer != 0) {
+        TimerService::getInstance().cancel(stall_timer);
+    }
+    return true;
+}
+
+bool ServerManager::setServerDraining(const std::string& id, bool draining, std::chrono::milliseconds timeout) {
+    TimerService::TimerId previous_timer = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto server = findServerById(id);
+        if (!server) {
+            return false;
+        }
+        server->setDraining(draining);
+        std::cout << "Server " << id << (draining ? " is draining" : " is no longer draining") << std::endl;
+
+        auto it = drain_timers_.find(id);
+        if (it != drain_timers_.end()) {
+            previous_timer = it->second;
+            drain_timers_.erase(it);
+        }
+        if (draining && timeout.count() > 0) {
+            drain_timers_[id] = TimerService::getInstance().schedule(timeout, [this, id] { onDrainTimeout(id); });
+        }
+    }
+    if (previous_timer != 0) {
+        TimerService::getInstance().cancel(previous_timer);
+    }
+    return true;
+}
+
+void ServerManager::onDrainTimeout(const std::string& id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        drain_timers_.erase(id);
+        auto server = findServerById(id);
+        if (!server || !server->isDraining()) {
+            return;
+        }
+    }
+    std::cout << "Server " << id << " finished draining" << std::endl;
+    if (!removeServerById(id)) {
+        std::cerr << "Could not remove drained server " << id << " (min servers reached)" << std::endl;
+    }
+}
+
+// Least populated node among the healthy backends, out of the nodes that
+// have CPUs to run them on; -1 if there are none
+int ServerManager::pickNumaNode() const {
+    const auto& topology = NumaTopology::getInstance();
+    std::vector<size_t> per_node(topology.getNodeCount(), 0);
+    for (const auto& srv : servers_) {
+        if (srv->isHealthy() && srv->getNumaNode() >= 0) {
+            per_node[srv->getNumaNode()]++;
+        }
+    }
+    int best = -1;
+    for (size_t node = 0; node < per_node.size(); ++node) {
+        if (!topology.hasCpus(static_cast<int>(node))) {
+            continue;
+        }
+        if (best < 0 || per_node[node] < per_node[best]) {
+            best = static_cast<int>(node);
+        }
+    }
+    return best;
+}
+
+std::shared_ptr<Server> ServerManager::addServer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_servers >= max_servers_) {
+        return nullptr;
+    }
+    auto server = std::make_shared<Server>(server_address, next_port_, options_.limiter);
+    std::string command = executable_path_ + " " + std::to_string(next_port_);
+    auto process = ProcessFactory::createProcess();
+    if (options_.numa_placement && NumaTopology::getInstance().getNodeCount() > 1) {
+        int node = pickNumaNode();
+        process->setNumaNode(node);
+        server->setNumaNode(node);
+    }
+    if (options_.cgroups && CgroupTree::getInstance().isAvailable()) {
+        std::string leaf = CgroupTree::getInstance().createLeaf("backend-" + std::to_string(next_port_),
+                                                                options_.cgroup_limits);
+        if (!leaf.empty()) {
+            process->setCgroup(leaf);
+        }
+    }
+    int heartbeat_fd = heartbeat_monitor_.createPage(server->getId());
+    if (heartbeat_fd >= 0) {
+        process->setHeartbeatFd(heartbeat_fd);
+    }
+    if (!process->start(command)) {
+        heartbeat_monitor_.unwatch(server->getId());
+        return nullptr;
+    }
+    server->setProcess(std::move(process));
+    server->startRamp(options_.slow_start);
+    servers_.push_back(server);
+    servers_by_id_[server->getId()] = server;
+    metrics_streamer_.watch(server);
+    health_watcher_.watch(server);
+    heartbeat_monitor_.watch(server);
+    exit_monitor_.watch(server);
+    active_servers++;
+    registry_version_++;
+    next_port_++;
+    publishSnapshot();
+    return server;
+}
+
+// int ServerManager::findAvailablePort() {
+//     // If we have available ports in our pool, use one
+//     if (!available_ports_.empty()) {
+//         int port = *available_ports_.begin();
+//         available_ports_.erase(available_ports_.begin());
+//         return port;
+//     }
+    
+//     // Otherwise, use the next_port_ if it's still within range
+//     if (next_port_ < start_port_ + max_port_range_) {
+//         int port = next_port_++;
+//         return port;
+//     }
+    
+//     return -1;
+// }
+
+bool ServerManager::updateServerHealth(const std::vector<HealthUpdate>& updates, uint64_t base_version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (base_version != 0 && base_version != registry_version_) {
+        return false;
+    }
+
+    bool health_changed = false;
+    for (const auto& update : updates) {
+        auto server = findServerById(update.id);
+        if (!server) {
+            continue;
+        }
+
+        if (update.healthy) {
+            //If a server dies unexpectedly (not through the health checker),
+            //the active_servers counter in ServerManager can become inconsistent with the actual number of healthy servers
+            if (*update.healthy && !server->isHealthy()) {
+                //it should never be the case that a server is unhealthy and not in the servers_ list,
+                //as the server which goes offline never comes back online on same port,
+                //but we should check for it anyway
+                active_servers++;
+                health_changed = true;
+            } else if (!*update.healthy && server->isHealthy()) {
+                active_servers--;
+                health_changed = true;
+            }
+            server->setHealthStatus(*update.healthy);
+        }
+        if (update.cpu_usage) {
+            server->setCPUUsage(*update.cpu_usage);
+        }
+        if (update.memory_usage) {
+            server->setMemoryUsage(*update.memory_usage);
+        }
+    }
+
+    // Metrics alone don't change who is routable
+    if (health_changed) {
+        registry_version_++;
+        publishSnapshot();
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<Server>> ServerManager::getActiveServers(uint64_t* registry_version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (registry_version) {
+        *registry_version = registry_version_;
+    }
+    std::vector<std::shared_ptr<Server>> active_servers;
+    for (const auto& srv : servers_) {
+        if (srv->isHealthy()) {
+            active_servers.push_back(srv);
+        }
+    }
+    return active_servers;
+}
+
+std::vector<std::shared_ptr<Server>> ServerManager::getRoutableServers() {
+    return getSnapshot()->servers;
+}
+
+void ServerManager::publishSnapshot() {
+    auto snapshot = std::make_shared<ServerSnapshot>();
+    for (const auto& srv : servers_) {
+        if (srv->isHealthy() && !srv->isEjected()) {
+            snapshot->servers.push_back(srv);
+        }
+    }
+    // Keeps each node's servers contiguous for NUMA-local selection
+    std::stable_sort(snapshot->servers.begin(), snapshot->servers.end(),
+        [](const std::shared_ptr<Server>& a, const std::shared_ptr<Server>& b) {
+            return a->getNumaNode() < b->getNumaNode();
+        });
+    for (size_t i = 0; i < snapshot->servers.size(); ++i) {
+        snapshot->servers[i]->setSnapshotIndex(i);
+    }
+    std::atomic_store(&snapshot_, std::shared_ptr<const ServerSnapshot>(std::move(snapshot)));
+}
+
+bool ServerManager::setServing(Server& server, bool serving) {
+    if (server.isHealthy() == serving) {
+        return false;
+    }
+    if (serving) {
+        active_servers++;
+    } else {
+        active_servers--;
+    }
+    server.setHealthStatus(serving);
+    registry_version_++;
+    publishSnapshot();
+    return true;
+}
+
+void ServerManager::onServingChanged(Server& server, bool serving) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!setServing(server, serving)) {
+            return;
+        }
+    }
+    std::cout << "Server " << server.getId() << (serving ? " is serving again" : " stopped serving") << std::endl;
+    if (!serving) {
+        addServer();
+    }
+}
+
+void ServerManager::onHeartbeatChanged(Server& server, bool serving) {
+    std::string id = server.getId();
+    TimerService::TimerId previous_timer = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!setServing(server, serving)) {
+            return;
+        }
+        auto it = stall_timers_.find(id);
+        if (it != stall_timers_.end()) {
+            previous_timer = it->second;
+            stall_timers_.erase(it);
+        }
+        if (!serving) {
+            stall_timers_[id] = TimerService::getInstance().schedule(STALL_REPLACE_GRACE, [this, id] { onStallTimeout(id); });
+        }
+    }
+    if (previous_timer != 0) {
+        TimerService::getInstance().cancel(previous_timer);
+    }
+    std::cout << "Server " << id << (serving ? " is serving again" : " is out of rotation until its heartbeat recovers")
+              << std::endl;
+}
+
+void ServerManager::onStallTimeout(const std::string& id) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stall_timers_.erase(id) == 0) {
+            return;
+        }
+        auto server = findServerById(id);
+        if (!server || server->isHealthy()) {
+            return;
+        }
+    }
+    std::cout << "Server " << id << " is still stalled, replacing it" << std::endl;
+    addServer();
+}
+
+void ServerManager::onProcessExited(Server& server) {
+    int exit_code = -1;
+    if (Process* process = server.getProcess()) {
+        exit_code = process->getExitCode();
+    }
+    std::cerr << "Backend " << server.getId() << " exited with code " << exit_code << std::endl;
+    // Its streams and heartbeat page are of no further use
+    metrics_streamer_.unwatch(server.getId());
+    health_watcher_.unwatch(server.getId());
+    heartbeat_monitor_.unwatch(server.getId());
+
+    // A stalled backend is already out of rotation, only its replacement
+    // is still pending
+    TimerService::TimerId stall_timer = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = stall_timers_.find(server.getId());
+        if (it != stall_timers_.end()) {
+            stall_timer = it->second;
+            stall_timers_.erase(it);
+        }
+    }
+    if (stall_timer == 0) {
+        onServingChanged(server, false);
+        return;
+    }
+    TimerService::getInstance().cancel(stall_timer);
+    addServer();
+}
+
+void ServerManager::recordRequestOutcome(Server& server, bool success, std::chrono::microseconds latency) {
+    if (!outlier_detector_.isEnabled()) {
+        return;
+    }
+    if (outlier_detector_.record(server, success, latency)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (outlier_detector_.eject(server, servers_, "consecutive failures")) {
+            publishSnapshot();
+        }
+    }
+    if (outlier_detector_.isAnalysisDue()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (outlier_detector_.analyze(servers_)) {
+            publishSnapshot();
+        }
+    }
+}
+
+ServerManager::ServerStats ServerManager::getServerStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ServerStats stats;
+    stats.total_servers = servers_.size();
+    stats.active_servers = active_servers;
+    stats.inactive_servers = servers_.size() - active_servers;
+    stats.min_servers = min_servers_;
+    stats.max_servers = max_servers_;
+    return stats;
 }
\ No newline at end of file
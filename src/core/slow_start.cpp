@@ -0,0 +1,16 @@
+#include "core/slow_start.hpp"
+#include <algorithm>
+#include <cmath>
+
+double SlowStartPolicy::factorAt(std::chrono::steady_clock::duration age) const {
+    if (!isEnabled() || age >= window) {
+        return 1.0;
+    }
+    double progress = std::max(0.0, std::chrono::duration<double>(age).count()
+                                    / std::chrono::duration<double>(window).count());
+    double floor = std::clamp(min_factor, 0.001, 1.0);
+    if (mode == Mode::Exponential) {
+        return floor * std::pow(1.0 / floor, progress);
+    }
+    return floor + (1.0 - floor) * progress;
+}
@@ -0,0 +1,37 @@
+#include "core/strategy_manager.hpp"
+#include "strategies/strategy_registry.hpp"
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+
+StrategyManager::StrategyManager(const std::string& initial_strategy) {
+    if (!setStrategy(initial_strategy)) {
+        throw std::invalid_argument("Unknown load balancing strategy: " + initial_strategy);
+    }
+}
+
+std::shared_ptr<Strategy> StrategyManager::getStrategy() const {
+    return std::atomic_load(&active_)->strategy;
+}
+
+std::string StrategyManager::getStrategyName() const {
+    return std::atomic_load(&active_)->name;
+}
+
+std::vector<std::string> StrategyManager::getAvailableStrategies() const {
+    return StrategyRegistry::getInstance().getNames();
+}
+
+bool StrategyManager::setStrategy(const std::string& name) {
+    if (pinned_) {
+        return false;
+    }
+    auto strategy = StrategyRegistry::getInstance().create(name);
+    if (!strategy) {
+        return false;
+    }
+    auto next = std::make_shared<const ActiveStrategy>(ActiveStrategy{name, std::move(strategy)});
+    std::atomic_store(&active_, std::shared_ptr<const ActiveStrategy>(std::move(next)));
+    std::cout << "Load balancing strategy set to: " << name << std::endl;
+    return true;
+}
@@ -1,85 +1,133 @@
-#include <iostream>
-#include <memory>
-#include <string>
-#include <csignal>
-#include <grpcpp/grpcpp.h>
-#include <thread> 
-
-#include "core/load_balancer.hpp"
-#include "core/server_manager.hpp"
-#include "api/admin_service.hpp"
-#include "api/crow_service.hpp"
-#include "utils/config.hpp"
-#include "utils/helper.hpp"
-
-std::unique_ptr<grpc::Server> g_server;
-bool g_shutting_down = false;
-std::shared_ptr<ServerManager> server_manager;
-
-void signalHandler(int signum) {
-    std::cout << "\nShutdown signal received. Cleaning up..." << std::endl;
-    g_shutting_down = true;
-
-    if (g_server) {
-        std::cout << "Shutting down gRPC server..." << std::endl;
-        g_server->Shutdown();
-    }
-}
-
-int main(int argc, char** argv) {
-    try {
-        // Register signal handler
-        signal(SIGINT, signalHandler);
-        signal(SIGTERM, signalHandler);
-
-        // Parse command line arguments
-        Config config = parseArgs(argc, argv);
-
-        //Get Configuration Settings
-        std::shared_ptr<Configuration> configuration = Configuration::getInstance();
-        
-        std::cout << "Initializing load balancer with configuration:\n"
-                  << "  Backend path: " << config.backend_path << "\n"
-                  << "  Load balancer port: " << config.lb_port << "\n"
-                  << "  Start port: " << config.start_port << "\n"
-                  << "  Min servers: " << config.min_servers << "\n"
-                  << "  Max servers: " << config.max_servers << std::endl;
-        
-        // server manager
-        server_manager = std::make_shared<ServerManager>(
-            config.backend_path,
-            config.start_port,
-            config.min_servers,
-            config.max_servers
-        );
-        
-        // load balancing strategy
-        auto strategy = configuration->getStrategy();
-        
-        // load balancer service
-        LoadBalancerService service(server_manager, strategy);
-
-        auto admin_service = std::make_unique<AdminService>(server_manager);
-
-        std::thread crowThread(runCrowServer, server_manager);
-        
-        // Setup and start gRPC server
-        std::string server_address = std::string(load_balancer_address) +":"+ std::to_string(config.lb_port);
-        grpc::ServerBuilder builder;
-        
-        builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-        builder.RegisterService(&service);
-        builder.RegisterService(admin_service.get());
-        
-        g_server = builder.BuildAndStart();
-        std::cout << "Load Balancer started at: " << server_address << std::endl;
-        
-        g_server->Wait();
-
-        std::cout << "Cleanup complete. Exiting." << std::endl;
-        return 0;
-    } catch (const std::exception& e) {
-        std::cerr << "Fatal error: " << e.what() << std::endl;
-        return 1;
-    }
+#include <iostream>
+#include <memory>
+#include <string>
+#include <csignal>
+#include <grpcpp/grpcpp.h>
+#include <thread> 
+
+#include "core/load_balancer.hpp"
+#include "core/server_manager.hpp"
+#include "core/strategy_manager.hpp"
+#include "api/admin_service.hpp"
+#include "api/crow_service.hpp"
+#include "monitoring/health_checker.hpp"
+#include "utils/config.hpp"
+#include "utils/helper.hpp"
+
+std::unique_ptr<grpc::Server> g_server;
+bool g_shutting_down = false;
+std::shared_ptr<ServerManager> server_manager;
+
+void signalHandler(int signum) {
+    std::cout << "\nShutdown signal received. Cleaning up..." << std::endl;
+    g_shutting_down = true;
+
+    if (g_server) {
+        std::cout << "Shutting down gRPC server..." << std::endl;
+        g_server->Shutdown();
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        // Register signal handler
+        signal(SIGINT, signalHandler);
+        signal(SIGTERM, signalHandler);
+
+        // Parse command line arguments
+        Config config = parseArgs(argc, argv);
+
+        //Get Configuration Settings
+        std::shared_ptr<Configuration> configuration = Configuration::getInstance();
+        
+        std::cout << "Initializing load balancer with configuration:\n"
+                  << "  Backend path: " << config.backend_path << "\n"
+                  << "  Load balancer port: " << config.lb_port << "\n"
+                  << "  Start port: " << config.start_port << "\n"
+                  << "  Min servers: " << config.min_servers << "\n"
+                  << "  Max servers: " << config.max_servers << "\n"
+                  << "  Strategy: " << config.strategy << std::endl;
+        
+        // server manager
+        ServerManager::Options server_options;
+        server_options.limiter.max_queue = config.max_queue;
+        server_options.limiter.queue_timeout = std::chrono::milliseconds(config.queue_timeout_ms);
+        server_options.numa_placement = config.numa_placement;
+        server_options.slow_start.window = std::chrono::milliseconds(config.slow_start_ms);
+        server_options.slow_start.min_factor = config.slow_start_min_factor;
+        server_options.slow_start.mode = config.slow_start_mode == "exponential"
+            ? SlowStartPolicy::Mode::Exponential
+            : SlowStartPolicy::Mode::Linear;
+        server_options.outlier_detection.enabled = config.outlier_detection;
+        server_options.outlier_detection.consecutive_failures = config.outlier_consecutive_failures;
+        server_options.outlier_detection.base_ejection_time = std::chrono::milliseconds(config.outlier_base_ejection_ms);
+        server_options.outlier_detection.max_ejection_percent = config.outlier_max_ejection_percent;
+        server_options.metrics_stream.interval = std::chrono::milliseconds(config.metrics_stream_ms);
+        server_options.health_watch.enabled = config.health_watch;
+        server_options.heartbeat.enabled = config.heartbeat;
+        server_options.heartbeat.stall_timeout = std::chrono::milliseconds(config.heartbeat_stall_ms);
+        server_options.heartbeat.wedge_timeout = std::chrono::milliseconds(config.heartbeat_wedge_ms);
+        server_options.cgroups = config.cgroups;
+        server_options.cgroup_limits.cpu_cores = config.cgroup_cpu_max;
+        server_options.cgroup_limits.memory_mb = static_cast<uint64_t>(std::max(0, config.cgroup_memory_max_mb));
+        server_manager = std::make_shared<ServerManager>(
+            config.backend_path,
+            config.start_port,
+            config.min_servers,
+            config.max_servers,
+            server_options
+        );
+        
+        std::unique_ptr<HealthChecker> health_checker;
+        if (config.embedded_health_checker) {
+            health_checker = std::make_unique<HealthChecker>(server_manager);
+            health_checker->start();
+            std::cout << "Health checker running in-process" << std::endl;
+        }
+
+        // load balancing strategy
+        auto strategy_manager = std::make_shared<StrategyManager>(config.strategy);
+        
+        // load balancer service
+        std::unique_ptr<loadbalancer::LoadBalancerService::Service> service;
+        if (config.pin_strategy) {
+            service = createSpecializedService(config.strategy, server_manager);
+            if (service) {
+                strategy_manager->pin();
+                std::cout << "Using specialised request path for strategy: " << config.strategy << std::endl;
+            } else {
+                std::cerr << "Strategy " << config.strategy
+                          << " has no specialised path, falling back to runtime dispatch" << std::endl;
+            }
+        }
+        if (!service) {
+            service = std::make_unique<LoadBalancerService>(server_manager, strategy_manager);
+        }
+
+        auto admin_service = std::make_unique<AdminService>(server_manager, strategy_manager);
+
+        std::thread crowThread(runCrowServer, server_manager, strategy_manager);
+        
+        // Setup and start gRPC server
+        std::string server_address = std::string(load_balancer_address) +":"+ std::to_string(config.lb_port);
+        grpc::ServerBuilder builder;
+        
+        builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+        builder.RegisterService(service.get());
+        builder.RegisterService(admin_service.get());
+        
+        g_server = builder.BuildAndStart();
+        std::cout << "Load Balancer started at: " << server_address << std::endl;
+        
+        g_server->Wait();
+        if (health_checker) {
+            health_checker->stop();
+        }
+
+        std::cout << "Cleanup complete. Exiting." << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << std::endl;
+        return 1;
+    }
 }
\ No newline at end of file
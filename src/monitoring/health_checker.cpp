@@ -1,303 +1,396 @@
-#include <iostream>
-#include <thread>
-#include <chrono>
-#include <grpcpp/grpcpp.h>
-#include "proto/admin_service.grpc.pb.h"
-#include "monitoring/health_checker.hpp"
-#include "utils/config.hpp"
-
-using namespace std::chrono_literals;
-
-const double SCALE_UP_CPU_THRESHOLD = 80.0;
-const double SCALE_DOWN_CPU_THRESHOLD = 20.0;
-static const double NEW_SERVER_USAGE = 0.0;
-
-HealthChecker::HealthChecker(const std::string& lb_admin_address)
-    : running_(false) {
-    auto channel = grpc::CreateChannel(lb_admin_address, grpc::InsecureChannelCredentials());
-    admin_stub_ = admin::AdminService::NewStub(channel);
-}
-
-HealthChecker::~HealthChecker() {
-    stop();
-}
-
-void HealthChecker::start() {
-    if (!running_) {
-        running_ = true;
-        health_check_thread_ = std::make_unique<std::thread>(&HealthChecker::checkHealth, this);
-    }
-}
-
-void HealthChecker::stop() {
-    if (running_) {
-        running_ = false;
-        if (health_check_thread_ && health_check_thread_->joinable()) {
-            health_check_thread_->join();
-        }
-    }
-}
-
-std::vector<admin::ServerInfo> HealthChecker::listAllServers() {
-    grpc::ClientContext ctx;
-    google::protobuf::Empty empty;
-    admin::ListServersResponse response;
-
-    auto status = admin_stub_->ListServers(&ctx, empty, &response);
-    if (!status.ok()) {
-        std::cerr << "ListServers RPC failed: " << status.error_message() << std::endl;
-        return {};
-    }
-
-    std::vector<admin::ServerInfo> result;
-    for (auto& server : *response.mutable_servers()) {
-        result.push_back(std::move(server));
-    }
-    return result;
-}
-
-bool HealthChecker::isServerResponding(const std::string& host, int port) {
-    SOCKET sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (sock == INVALID_SOCKET) {
-        std::cerr << "Failed to create socket: " << WSAGetLastError() << std::endl;
-        return false;
-    }
-
-    // Set socket timeout
-    DWORD timeout = 5000; // 5 seconds
-    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (char*)&timeout, sizeof(timeout));
-    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (char*)&timeout, sizeof(timeout));
-
-    u_long mode = 1;
-    if (ioctlsocket(sock, FIONBIO, &mode) != 0) {
-        std::cerr << "Failed to set non-blocking mode: " << WSAGetLastError() << std::endl;
-        closesocket(sock);
-        return false;
-    }
-
-    sockaddr_in server_addr;
-    server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(port);
-
-    if (inet_pton(AF_INET, host.c_str(), &server_addr.sin_addr) != 1) {
-        std::cerr << "Invalid address: " << host << std::endl;
-        closesocket(sock);
-        return false;
-    }
-
-    // Attempt connection
-    int result = connect(sock, (sockaddr*)&server_addr, sizeof(server_addr));
-    if (result == SOCKET_ERROR) {
-        int error = WSAGetLastError();
-        if (error != WSAEWOULDBLOCK) {
-            std::cerr << "Connection failed for " << host << ":" << port
-                      << ", error: " << error << std::endl;
-            closesocket(sock);
-            return false;
-        }
-
-        // Use select to wait for the connection
-        fd_set write_fds;
-        FD_ZERO(&write_fds);
-        FD_SET(sock, &write_fds);
-
-        timeval tv;
-        tv.tv_sec = 5;  // 5 seconds
-        tv.tv_usec = 0;
-
-        result = select(0, nullptr, &write_fds, nullptr, &tv);
-        if (result <= 0) {
-            std::cerr << "Select failed or timed out for " << host << ":" << port
-                      << ", error: " << WSAGetLastError() << std::endl;
-            closesocket(sock);
-            return false;
-        }
-    }
-
-    // Set back to blocking mode
-    mode = 0;
-    ioctlsocket(sock, FIONBIO, &mode);
-
-    closesocket(sock);
-    return true;
-}
-
-void HealthChecker::updateServerHealth(const std::vector<admin::UpdateServerHealthRequest>& updates) {
-    admin::UpdateServerHealthRequests req;
-    
-    for (auto& u : updates) {
-        auto* s = req.add_updates();
-        s->set_id(u.id());
-        s->set_ishealthy(u.ishealthy());
-        s->set_cpu_usage(u.cpu_usage());
-        s->set_memory_usage(u.memory_usage());
-    }
-
-    grpc::ClientContext ctx;
-    google::protobuf::Empty empty;
-    auto status = admin_stub_->UpdateServerHealth(&ctx, req, &empty);
-    
-    if (!status.ok()) {
-        std::cerr << "UpdateServerHealth RPC failed!\n"
-                  << "Status code: " << status.error_code() << "\n"
-                  << "Message: " << status.error_message() << "\n"
-                  << "Details: " << status.error_details() << std::endl;
-    } else {
-        std::cout << "Health update completed successfully" << std::endl;
-    }
-}
-
-bool HealthChecker::getServerMetrics(const std::string& host, int port, double& outCpu, double& outMem) {
-    std::string target = host + ":" + std::to_string(port);
-    auto channel = grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
-    auto stub = admin::AdminService::NewStub(channel);
-
-    google::protobuf::Empty empty;
-    admin::MetricsResponse resp;
-    grpc::ClientContext ctx;
-    auto status = stub->GetMetrics(&ctx, empty, &resp);
-    if (!status.ok()) {
-        std::cerr << "GetMetrics RPC failed for " << target 
-                  << ": " << status.error_message() << std::endl;
-        return false;
-    }
-    outCpu = resp.cpu_usage();
-    outMem = resp.memory_usage();
-    return true;
-}
-
-admin::ServerConstraintsResponse HealthChecker::getServerLimits() {
-    grpc::ClientContext ctx;
-    google::protobuf::Empty empty;
-    admin::ServerConstraintsResponse resp;
-    auto status = admin_stub_->GetServerConstraints(&ctx, empty, &resp);
-    if (!status.ok()) {
-        std::cerr << "GetServerConstraints RPC failed: " << status.error_message() << std::endl;
-    }
-    return resp;
-}
-
-void HealthChecker::addServer() {
-    grpc::ClientContext ctx;
-    google::protobuf::Empty empty;
-    admin::AddServerResponse resp;
-    auto status = admin_stub_->AddServer(&ctx, empty, &resp);
-    if (!status.ok()) {
-        std::cerr << "AddServer RPC failed: " << status.error_message() << std::endl;
-    } else {
-        std::cout << "Created new server with ID " << resp.id() << std::endl;
-    }
-}
-
-void HealthChecker::removeServer(const std::string& serverId) {
-    admin::RemoveServerRequest req;
-    req.set_id(serverId);
-
-    grpc::ClientContext ctx;
-    google::protobuf::Empty empty;
-    auto status = admin_stub_->RemoveServer(&ctx, req, &empty);
-    if (!status.ok()) {
-        std::cerr << "RemoveServer RPC failed for " << serverId
-                  << ": " << status.error_message() << std::endl;
-    }
-}
-
-void HealthChecker::handleAutoScaling(double cpu, const std::string& serverId, 
-                                     const admin::ServerConstraintsResponse& constraints) {
-    if (cpu > SCALE_UP_CPU_THRESHOLD && constraints.active_servers() < constraints.max_servers()) {
-        std::cout << "Scaling up due to high CPU on server " << serverId << std::endl;
-        //Scale Up
-        addServer();
-    } else if (cpu < SCALE_DOWN_CPU_THRESHOLD && constraints.active_servers() > constraints.min_servers()) {
-        std::cout << "Scaling down server " << serverId << " due to low CPU usage" << std::endl;
-        //Scale Down
-        removeServer(serverId);
-    } else {
-        // No scaling needed or possible
-        if (cpu > SCALE_UP_CPU_THRESHOLD) {
-            std::cout << "Server " << serverId << " CPU high but already at max servers limit" << std::endl;
-        } else if (cpu < SCALE_DOWN_CPU_THRESHOLD) {
-            std::cout << "Server " << serverId << " CPU low but already at min servers limit" << std::endl;
-        }
-    }
-}
-
-void HealthChecker::checkServersOnce() {
-    std::cout << "\n=== External Health Check Started ===" << std::endl;
-
-    auto servers = listAllServers();
-    auto constraints = getServerLimits();
-    std::cout << "Active servers: " << constraints.active_servers() << std::endl;
-    std::vector<admin::UpdateServerHealthRequest> updates;  
-
-    for (auto& s : servers) {
-        admin::UpdateServerHealthRequest server_metrics;
-        server_metrics.set_id(s.id());
-
-        bool currentHealth = s.ishealthy();
-        bool check = isServerResponding(s.host(), s.port());
-        
-        std::cout << "Checking server " << s.id() << ":\n"
-                  << "  Status: " << (check ? "Healthy" : "Unhealthy") << std::endl;
-
-        if (currentHealth && !check) {
-            std::cout << "Server " << s.id() << " is down" << std::endl;
-            //Current server is unhealthy
-            server_metrics.set_ishealthy(false);
-            //Add new server
-            addServer();
-        } else if(check){
-            server_metrics.set_ishealthy(true);
-
-            double cpu, mem;
-            if (getServerMetrics(s.host(), s.port(), cpu, mem)) {
-                server_metrics.set_cpu_usage(cpu);
-                server_metrics.set_memory_usage(mem);
-
-                std::cout << "Server " << s.id() << ":\n"
-                          << "  CPU: " << cpu << "%\n"
-                          << "  Memory: " << mem << "%\n";
-                
-                handleAutoScaling(cpu, s.id(), constraints);
-            }
-        }
-        updates.push_back(server_metrics);
-    }
-
-    updateServerHealth(updates);
-
-    std::cout << "=== Health Check Completed ===" << std::endl;
-}
-
-void HealthChecker::checkHealth() {
-    while (running_) {
-        checkServersOnce();
-        std::this_thread::sleep_for(std::chrono::seconds(health_checker_sleep_time));
-    }
-}
-
-
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <load_balancer_admin_address>\n"
-                  << " e.g.: health_checker_main 127.0.0.1:50050\n";
-        return 1;
-    }
-    std::string lb_admin_address = argv[1];
-    
-    HealthChecker healthChecker(lb_admin_address);
-    
-    // healthChecker.checkServersOnce();
-    
-    // Run continuous health checks in a dedicated thread
-    healthChecker.start();
-    
-    std::cout << "Health checker running. Press Ctrl+C to stop." << std::endl;
-    
-    std::string input;
-    std::getline(std::cin, input);
-    
-    healthChecker.stop();
-
-    return 0;
-}
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <grpcpp/grpcpp.h>
+#include "proto/admin_service.grpc.pb.h"
+#include "monitoring/health_checker.hpp"
+#include "utils/config.hpp"
+#include "utils/random.hpp"
+
+using namespace std::chrono_literals;
+
+const double SCALE_UP_CPU_THRESHOLD = 80.0;
+const double SCALE_DOWN_CPU_THRESHOLD = 20.0;
+static const double NEW_SERVER_USAGE = 0.0;
+static const auto METRICS_TIMEOUT = std::chrono::seconds(2);
+static const int MAX_SWEEP_ATTEMPTS = 3;
+// How often the checker looks for servers it has not seen yet
+static const auto DISCOVERY_INTERVAL = std::chrono::seconds(5);
+static const auto FAST_RECHECK_INTERVAL = std::chrono::seconds(1);
+// Probes that come due within this long of the first one share its pass
+static const auto PROBE_COALESCE_WINDOW = std::chrono::milliseconds(200);
+static const int FAILURES_BEFORE_DOWN = 2;
+// After this many good probes in a row the interval doubles per probe,
+// up to MAX_BACKOFF_FACTOR times the base interval
+static const int OK_PROBES_BEFORE_BACKOFF = 3;
+static const int MAX_BACKOFF_FACTOR = 4;
+static const double PROBE_JITTER = 0.2;
+
+HealthChecker::HealthChecker(const std::string& lb_admin_address)
+    : running_(false)
+    , control_(std::make_unique<RemoteLoadBalancerControl>(lb_admin_address)) {}
+
+HealthChecker::HealthChecker(std::shared_ptr<ServerManager> server_manager)
+    : running_(false)
+    , control_(std::make_unique<LocalLoadBalancerControl>(std::move(server_manager))) {}
+
+HealthChecker::~HealthChecker() {
+    stop();
+}
+
+void HealthChecker::start() {
+    if (!running_) {
+        running_ = true;
+        health_check_thread_ = std::make_unique<std::thread>(&HealthChecker::checkHealth, this);
+    }
+}
+
+void HealthChecker::stop() {
+    if (running_) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            running_ = false;
+        }
+        wake_.notify_all();
+        if (health_check_thread_ && health_check_thread_->joinable()) {
+            health_check_thread_->join();
+        }
+        cancelProbes();
+    }
+}
+
+void HealthChecker::cancelProbes() {
+    // Waits out any timer callback still running, so none touches this
+    // object afterwards
+    for (auto& entry : probe_states_) {
+        if (entry.second.timer != 0) {
+            TimerService::getInstance().cancel(entry.second.timer);
+        }
+    }
+    probe_states_.clear();
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    due_.clear();
+}
+
+void HealthChecker::scheduleProbe(const std::string& id, ProbeState& state) {
+    if (state.timer != 0) {
+        TimerService::getInstance().cancel(state.timer);
+    }
+    // Jitter keeps servers added together from being probed in lockstep
+    double factor = 1.0 - PROBE_JITTER + 2.0 * PROBE_JITTER * fastRandomUnit();
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(state.interval * factor);
+    state.timer = TimerService::getInstance().schedule(delay, [this, id] {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            due_.insert(id);
+        }
+        wake_.notify_all();
+    });
+}
+
+void HealthChecker::applyOutcome(const std::string& id, ProbeOutcome outcome) {
+    std::chrono::milliseconds base = std::max<std::chrono::milliseconds>(
+        std::chrono::seconds(health_checker_sleep_time), FAST_RECHECK_INTERVAL);
+    auto& state = probe_states_[id];
+    switch (outcome) {
+    case ProbeOutcome::Ok:
+        state.consecutive_failures = 0;
+        state.consecutive_ok++;
+        if (state.consecutive_ok > OK_PROBES_BEFORE_BACKOFF && state.interval >= base) {
+            state.interval = std::min(state.interval * 2, base * MAX_BACKOFF_FACTOR);
+        } else {
+            state.interval = base;
+        }
+        break;
+    case ProbeOutcome::MetricsFailed:
+        state.consecutive_ok = 0;
+        state.interval = FAST_RECHECK_INTERVAL;
+        break;
+    case ProbeOutcome::Suspect:
+        state.consecutive_ok = 0;
+        state.consecutive_failures++;
+        state.interval = FAST_RECHECK_INTERVAL;
+        break;
+    }
+    scheduleProbe(id, state);
+}
+
+admin::AdminService::Stub& HealthChecker::getMetricsStub(const admin::ServerInfo& server) {
+    auto& stub = metrics_stubs_[server.id()];
+    if (!stub) {
+        std::string target = server.host() + ":" + std::to_string(server.port());
+        stub = admin::AdminService::NewStub(grpc::CreateChannel(target, grpc::InsecureChannelCredentials()));
+    }
+    return *stub;
+}
+
+std::vector<HealthChecker::ServerMetrics> HealthChecker::getServerMetrics(const std::vector<admin::ServerInfo>& servers,
+                                                                          const std::vector<bool>& responding) {
+    struct MetricsCall {
+        grpc::ClientContext context;
+        admin::MetricsResponse response;
+        grpc::Status status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<admin::MetricsResponse>> reader;
+    };
+
+    std::vector<ServerMetrics> results(servers.size());
+    std::vector<std::unique_ptr<MetricsCall>> calls(servers.size());
+    google::protobuf::Empty empty;
+    grpc::CompletionQueue cq;
+    auto deadline = std::chrono::system_clock::now() + METRICS_TIMEOUT;
+
+    // Start every call before waiting on any of them
+    size_t pending = 0;
+    for (size_t i = 0; i < servers.size(); ++i) {
+        if (!responding[i]) continue;
+        auto call = std::make_unique<MetricsCall>();
+        call->context.set_deadline(deadline);
+        call->reader = getMetricsStub(servers[i]).AsyncGetMetrics(&call->context, empty, &cq);
+        call->reader->Finish(&call->response, &call->status, reinterpret_cast<void*>(i));
+        calls[i] = std::move(call);
+        pending++;
+    }
+
+    void* tag;
+    bool ok;
+    while (pending > 0 && cq.Next(&tag, &ok)) {
+        size_t i = reinterpret_cast<size_t>(tag);
+        pending--;
+        const auto& call = calls[i];
+        if (ok && call->status.ok()) {
+            results[i] = {true, call->response.cpu_usage(), call->response.memory_usage()};
+        } else {
+            std::cerr << "GetMetrics RPC failed for " << servers[i].id()
+                      << ": " << call->status.error_message() << std::endl;
+        }
+    }
+    cq.Shutdown();
+    while (cq.Next(&tag, &ok)) {
+    }
+    return results;
+}
+
+void HealthChecker::handleAutoScaling(double cpu, const std::string& serverId, 
+                                     const admin::ServerConstraintsResponse& constraints,
+                                     ScalingPlan& plan) {
+    if (cpu > SCALE_UP_CPU_THRESHOLD && constraints.active_servers() < constraints.max_servers()) {
+        std::cout << "Scaling up due to high CPU on server " << serverId << std::endl;
+        //Scale Up
+        plan.servers_to_add++;
+    } else if (cpu < SCALE_DOWN_CPU_THRESHOLD && constraints.active_servers() > constraints.min_servers()) {
+        std::cout << "Scaling down server " << serverId << " due to low CPU usage" << std::endl;
+        //Scale Down
+        plan.servers_to_remove.push_back(serverId);
+    } else {
+        // No scaling needed or possible
+        if (cpu > SCALE_UP_CPU_THRESHOLD) {
+            std::cout << "Server " << serverId << " CPU high but already at max servers limit" << std::endl;
+        } else if (cpu < SCALE_DOWN_CPU_THRESHOLD) {
+            std::cout << "Server " << serverId << " CPU low but already at min servers limit" << std::endl;
+        }
+    }
+}
+
+void HealthChecker::checkServersOnce() {
+    checkServers(nullptr);
+}
+
+void HealthChecker::checkServers(const std::unordered_set<std::string>* due) {
+    std::cout << "\n=== Health Check Started ===" << std::endl;
+    for (int attempt = 1; !runSweep(due); ++attempt) {
+        if (attempt == MAX_SWEEP_ATTEMPTS) {
+            std::cerr << "Server registry kept changing, giving up until the next check" << std::endl;
+            if (due) {
+                // Their timers have fired; without a new one they would
+                // never be probed again
+                for (const auto& id : *due) {
+                    auto state = probe_states_.find(id);
+                    if (state != probe_states_.end()) {
+                        state->second.interval = FAST_RECHECK_INTERVAL;
+                        scheduleProbe(id, state->second);
+                    }
+                }
+            }
+            break;
+        }
+        std::cout << "Server registry changed during the check, retrying" << std::endl;
+    }
+    std::cout << "=== Health Check Completed ===" << std::endl;
+}
+
+bool HealthChecker::runSweep(const std::unordered_set<std::string>* due) {
+    // Scheduled passes reuse the last listing until the next discovery pass;
+    // anything that changes the registry invalidates it first
+    auto now = std::chrono::steady_clock::now();
+    if (!due || due->empty() || !listing_valid_ || now - listed_at_ >= DISCOVERY_INTERVAL) {
+        listing_ = control_->listServers();
+        constraints_ = control_->getServerConstraints();
+        listed_at_ = now;
+        listing_valid_ = true;
+    }
+    const auto& listing = listing_;
+    const auto& constraints = constraints_;
+    std::cout << "Active servers: " << constraints.active_servers() << std::endl;
+
+    // Scheduled passes only probe the servers that came due, plus new ones
+    std::vector<admin::ServerInfo> servers;
+    std::vector<size_t> positions;  // of servers in the listing
+    std::unordered_set<std::string> listed;
+    for (size_t i = 0; i < listing.servers.size(); ++i) {
+        const auto& s = listing.servers[i];
+        listed.insert(s.id());
+        if (!due || due->count(s.id()) || !probe_states_.count(s.id())) {
+            servers.push_back(s);
+            positions.push_back(i);
+        }
+    }
+
+    // Only fields that differ from the listing are sent
+    admin::UpdateServerHealthRequests updates;
+    updates.set_base_version(listing.registry_version);
+    std::vector<size_t> updated;  // listing position of each update
+    ScalingPlan plan;
+    std::vector<ProbeOutcome> outcomes(servers.size(), ProbeOutcome::Ok);
+
+    // Probe every server at once rather than one after another
+    std::vector<TcpProber::Endpoint> endpoints;
+    for (const auto& s : servers) {
+        endpoints.push_back({s.host(), static_cast<int>(s.port())});
+    }
+    auto responding = prober_.probeAll(endpoints);
+    auto metrics = getServerMetrics(servers, responding);
+
+    for (size_t i = 0; i < servers.size(); ++i) {
+        auto& s = servers[i];
+        admin::UpdateServerHealthRequest delta;
+        delta.set_id(s.id());
+
+        bool currentHealth = s.ishealthy();
+        bool check = responding[i];
+        
+        std::cout << "Checking server " << s.id() << ":\n"
+                  << "  Status: " << (check ? "Healthy" : "Unhealthy") << std::endl;
+
+        if (currentHealth && !check) {
+            // On a schedule, a single failed probe only earns a quick re-probe
+            auto state = probe_states_.find(s.id());
+            if (due && state != probe_states_.end() &&
+                state->second.consecutive_failures + 1 < FAILURES_BEFORE_DOWN) {
+                std::cout << "Server " << s.id() << " did not respond, re-checking soon" << std::endl;
+                outcomes[i] = ProbeOutcome::Suspect;
+            } else {
+                std::cout << "Server " << s.id() << " is down" << std::endl;
+                //Current server is unhealthy
+                delta.set_ishealthy(false);
+                // It won't be listed again; forget it along with the unlisted ones
+                listed.erase(s.id());
+                //Add new server
+                plan.servers_to_add++;
+            }
+        } else if(check){
+            if (!currentHealth) {
+                delta.set_ishealthy(true);
+            }
+
+            if (metrics[i].ok) {
+                double cpu = metrics[i].cpu;
+                double mem = metrics[i].memory;
+                if (cpu != s.cpu_usage()) {
+                    delta.set_cpu_usage(cpu);
+                }
+                if (mem != s.memory_usage()) {
+                    delta.set_memory_usage(mem);
+                }
+
+                std::cout << "Server " << s.id() << ":\n"
+                          << "  CPU: " << cpu << "%\n"
+                          << "  Memory: " << mem << "%\n";
+                
+                handleAutoScaling(cpu, s.id(), constraints, plan);
+            } else {
+                outcomes[i] = ProbeOutcome::MetricsFailed;
+            }
+        }
+
+        if (delta.has_ishealthy() || delta.has_cpu_usage() || delta.has_memory_usage()) {
+            *updates.add_updates() = std::move(delta);
+            updated.push_back(positions[i]);
+        }
+    }
+
+    if (updates.updates_size() > 0) {
+        auto result = control_->updateServerHealth(updates);
+        if (result == LoadBalancerControl::UpdateResult::Conflict) {
+            listing_valid_ = false;
+            return false;
+        }
+        // Keep the cached listing in step with what was just reported
+        for (int u = 0; result == LoadBalancerControl::UpdateResult::Applied && u < updates.updates_size(); ++u) {
+            const auto& delta = updates.updates(u);
+            auto& cached = listing_.servers[updated[u]];
+            if (delta.has_cpu_usage()) {
+                cached.set_cpu_usage(delta.cpu_usage());
+            }
+            if (delta.has_memory_usage()) {
+                cached.set_memory_usage(delta.memory_usage());
+            }
+            if (delta.has_ishealthy()) {
+                listing_valid_ = false;  // the registry version moved on
+            }
+        }
+        if (result == LoadBalancerControl::UpdateResult::Failed) {
+            listing_valid_ = false;
+        }
+    } else {
+        std::cout << "No changes to report" << std::endl;
+    }
+
+    // Drop channels to servers that are no longer listed
+    for (auto it = metrics_stubs_.begin(); it != metrics_stubs_.end();) {
+        it = listed.count(it->first) ? std::next(it) : metrics_stubs_.erase(it);
+    }
+    if (due) {
+        for (size_t i = 0; i < servers.size(); ++i) {
+            if (listed.count(servers[i].id())) {
+                applyOutcome(servers[i].id(), outcomes[i]);
+            }
+        }
+        for (auto it = probe_states_.begin(); it != probe_states_.end();) {
+            if (listed.count(it->first)) {
+                ++it;
+                continue;
+            }
+            if (it->second.timer != 0) {
+                TimerService::getInstance().cancel(it->second.timer);
+            }
+            it = probe_states_.erase(it);
+        }
+    }
+
+    if (plan.servers_to_add > 0 || !plan.servers_to_remove.empty()) {
+        listing_valid_ = false;
+    }
+    for (size_t i = 0; i < plan.servers_to_add; ++i) {
+        control_->addServer();
+    }
+    for (const auto& id : plan.servers_to_remove) {
+        control_->removeServer(id);
+    }
+    return true;
+}
+
+void HealthChecker::checkHealth() {
+    // The first pass finds every server new and probes them all
+    std::unordered_set<std::string> due;
+    while (running_) {
+        checkServers(&due);
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait_for(lock, DISCOVERY_INTERVAL, [this] { return !running_ || !due_.empty(); });
+        if (running_ && !due_.empty()) {
+            wake_.wait_for(lock, PROBE_COALESCE_WINDOW, [this] { return !running_; });
+        }
+        due.clear();
+        due.swap(due_);
+    }
+}
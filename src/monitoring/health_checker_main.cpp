@@ -0,0 +1,28 @@
+#include <iostream>
+#include <string>
+#include "monitoring/health_checker.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <load_balancer_admin_address>\n"
+                  << " e.g.: health_checker_main 127.0.0.1:50050\n";
+        return 1;
+    }
+    std::string lb_admin_address = argv[1];
+    
+    HealthChecker healthChecker(lb_admin_address);
+    
+    // healthChecker.checkServersOnce();
+    
+    // Run continuous health checks in a dedicated thread
+    healthChecker.start();
+    
+    std::cout << "Health checker running. Press Ctrl+C to stop." << std::endl;
+    
+    std::string input;
+    std::getline(std::cin, input);
+    
+    healthChecker.stop();
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "monitoring/lb_control.hpp"
+#include "api/admin_service.hpp"
+#include "core/server_manager.hpp"
+#include <iostream>
+#include <grpcpp/grpcpp.h>
+
+RemoteLoadBalancerControl::RemoteLoadBalancerControl(const std::string& lb_admin_address) {
+    auto channel = grpc::CreateChannel(lb_admin_address, grpc::InsecureChannelCredentials());
+    admin_stub_ = admin::AdminService::NewStub(channel);
+}
+
+LoadBalancerControl::ServerListing RemoteLoadBalancerControl::listServers() {
+    grpc::ClientContext ctx;
+    google::protobuf::Empty empty;
+    admin::ListServersResponse response;
+
+    auto status = admin_stub_->ListServers(&ctx, empty, &response);
+    if (!status.ok()) {
+        std::cerr << "ListServers RPC failed: " << status.error_message() << std::endl;
+        return {};
+    }
+
+    ServerListing result;
+    result.registry_version = response.registry_version();
+    for (auto& server : *response.mutable_servers()) {
+        result.servers.push_back(std::move(server));
+    }
+    return result;
+}
+
+admin::ServerConstraintsResponse RemoteLoadBalancerControl::getServerConstraints() {
+    grpc::ClientContext ctx;
+    google::protobuf::Empty empty;
+    admin::ServerConstraintsResponse resp;
+    auto status = admin_stub_->GetServerConstraints(&ctx, empty, &resp);
+    if (!status.ok()) {
+        std::cerr << "GetServerConstraints RPC failed: " << status.error_message() << std::endl;
+    }
+    return resp;
+}
+
+LoadBalancerControl::UpdateResult RemoteLoadBalancerControl::updateServerHealth(const admin::UpdateServerHealthRequests& req) {
+    grpc::ClientContext ctx;
+    google::protobuf::Empty empty;
+    auto status = admin_stub_->UpdateServerHealth(&ctx, req, &empty);
+
+    if (status.error_code() == grpc::StatusCode::ABORTED) {
+        return UpdateResult::Conflict;
+    }
+    if (!status.ok()) {
+        std::cerr << "UpdateServerHealth RPC failed!\n"
+                  << "Status code: " << status.error_code() << "\n"
+                  << "Message: " << status.error_message() << "\n"
+                  << "Details: " << status.error_details() << std::endl;
+        return UpdateResult::Failed;
+    }
+    std::cout << "Health update completed successfully" << std::endl;
+    return UpdateResult::Applied;
+}
+
+void RemoteLoadBalancerControl::addServer() {
+    grpc::ClientContext ctx;
+    google::protobuf::Empty empty;
+    admin::AddServerResponse resp;
+    auto status = admin_stub_->AddServer(&ctx, empty, &resp);
+    if (!status.ok()) {
+        std::cerr << "AddServer RPC failed: " << status.error_message() << std::endl;
+    } else {
+        std::cout << "Created new server with ID " << resp.id() << std::endl;
+    }
+}
+
+void RemoteLoadBalancerControl::removeServer(const std::string& serverId) {
+    admin::RemoveServerRequest req;
+    req.set_id(serverId);
+
+    grpc::ClientContext ctx;
+    google::protobuf::Empty empty;
+    auto status = admin_stub_->RemoveServer(&ctx, req, &empty);
+    if (!status.ok()) {
+        std::cerr << "RemoveServer RPC failed for " << serverId
+                  << ": " << status.error_message() << std::endl;
+    }
+}
+
+LocalLoadBalancerControl::LocalLoadBalancerControl(std::shared_ptr<ServerManager> server_manager)
+    : server_manager_(std::move(server_manager)) {}
+
+LoadBalancerControl::ServerListing LocalLoadBalancerControl::listServers() {
+    ServerListing result;
+    for (const auto& server : server_manager_->getActiveServers(&result.registry_version)) {
+        admin::ServerInfo info;
+        info.set_id(server->getId());
+        info.set_host(server->getAddress());
+        info.set_port(server->getPort());
+        info.set_ishealthy(server->isHealthy());
+        info.set_cpu_usage(server->getCPUUsage());
+        info.set_memory_usage(server->getMemoryUsage());
+        result.servers.push_back(std::move(info));
+    }
+    return result;
+}
+
+admin::ServerConstraintsResponse LocalLoadBalancerControl::getServerConstraints() {
+    auto stats = server_manager_->getServerStats();
+    admin::ServerConstraintsResponse resp;
+    resp.set_min_servers(static_cast<uint32_t>(stats.min_servers));
+    resp.set_max_servers(static_cast<uint32_t>(stats.max_servers));
+    resp.set_active_servers(static_cast<uint32_t>(stats.active_servers));
+    return resp;
+}
+
+LoadBalancerControl::UpdateResult LocalLoadBalancerControl::updateServerHealth(const admin::UpdateServerHealthRequests& req) {
+    bool applied = server_manager_->updateServerHealth(AdminService::toHealthUpdates(req), req.base_version());
+    return applied ? UpdateResult::Applied : UpdateResult::Conflict;
+}
+
+void LocalLoadBalancerControl::addServer() {
+    auto server = server_manager_->addServer();
+    if (!server) {
+        std::cerr << "Could not add a server (max servers reached or start failed)" << std::endl;
+    } else {
+        std::cout << "Created new server with ID " << server->getId() << std::endl;
+    }
+}
+
+void LocalLoadBalancerControl::removeServer(const std::string& serverId) {
+    if (!server_manager_->removeServerById(serverId)) {
+        std::cerr << "Could not remove server " << serverId
+                  << " (not found or min servers reached)" << std::endl;
+    }
+}
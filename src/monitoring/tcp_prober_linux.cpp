@@ -0,0 +1,135 @@
+#include "monitoring/tcp_prober.hpp"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Probes in flight at once; keeps us well below the default fd limit
+static const size_t MAX_CONCURRENT_PROBES = 512;
+static const int MAX_EVENTS = 256;
+
+TcpProber::TcpProber(std::chrono::milliseconds timeout)
+    : timeout_(timeout) {}
+
+std::vector<bool> TcpProber::probeAll(const std::vector<Endpoint>& endpoints) const {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<bool> results(endpoints.size(), false);
+    if (endpoints.empty()) {
+        return results;
+    }
+
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        std::cerr << "epoll_create1 failed: " << std::strerror(errno) << std::endl;
+        return results;
+    }
+
+    struct Pending {
+        int fd = -1;
+        Clock::time_point deadline;
+    };
+    std::vector<Pending> pending(endpoints.size());
+    // Started probes in start order, which is also deadline order
+    std::deque<size_t> started;
+    size_t next = 0;
+    size_t in_flight = 0;
+
+    auto finish = [&](size_t index, bool ok) {
+        if (pending[index].fd < 0) {
+            return;
+        }
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, pending[index].fd, nullptr);
+        close(pending[index].fd);
+        pending[index].fd = -1;
+        results[index] = ok;
+        in_flight--;
+        if (!ok) {
+            std::cerr << "Connection failed for " << endpoints[index].host << ":" << endpoints[index].port << std::endl;
+        }
+    };
+
+    auto start = [&](size_t index) {
+        const auto& endpoint = endpoints[index];
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(endpoint.port));
+        if (inet_pton(AF_INET, endpoint.host.c_str(), &addr.sin_addr) != 1) {
+            std::cerr << "Invalid address: " << endpoint.host << std::endl;
+            return;
+        }
+
+        int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            std::cerr << "Failed to create socket: " << std::strerror(errno) << std::endl;
+            return;
+        }
+        pending[index].fd = fd;
+        pending[index].deadline = Clock::now() + timeout_;
+        in_flight++;
+
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+            finish(index, true);
+            return;
+        }
+        if (errno != EINPROGRESS) {
+            finish(index, false);
+            return;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLOUT | EPOLLERR | EPOLLHUP;
+        event.data.u64 = index;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            finish(index, false);
+            return;
+        }
+        started.push_back(index);
+    };
+
+    epoll_event events[MAX_EVENTS];
+    while (next < endpoints.size() || in_flight > 0) {
+        while (next < endpoints.size() && in_flight < MAX_CONCURRENT_PROBES) {
+            start(next++);
+        }
+
+        // Expire probes past their deadline; the oldest is at the front
+        auto now = Clock::now();
+        while (!started.empty() && (pending[started.front()].fd < 0 || pending[started.front()].deadline <= now)) {
+            if (pending[started.front()].fd >= 0) {
+                finish(started.front(), false);
+            }
+            started.pop_front();
+        }
+        if (in_flight == 0) {
+            continue;
+        }
+
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(pending[started.front()].deadline - now);
+        int ready = epoll_wait(epoll_fd, events, MAX_EVENTS, static_cast<int>(wait.count()) + 1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        for (int i = 0; i < ready; ++i) {
+            size_t index = static_cast<size_t>(events[i].data.u64);
+            int error = 0;
+            socklen_t length = sizeof(error);
+            bool ok = getsockopt(pending[index].fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0;
+            finish(index, ok);
+        }
+    }
+
+    // Only reached early if epoll_wait failed
+    for (size_t index : started) {
+        finish(index, false);
+    }
+    close(epoll_fd);
+    return results;
+}
@@ -0,0 +1,76 @@
+#include "monitoring/tcp_prober.hpp"
+#include <iostream>
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+
+#pragma comment(lib, "Ws2_32.lib")
+
+TcpProber::TcpProber(std::chrono::milliseconds timeout)
+    : timeout_(timeout) {}
+
+static bool isServerResponding(const std::string& host, int port, std::chrono::milliseconds timeout) {
+    SOCKET sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock == INVALID_SOCKET) {
+        std::cerr << "Failed to create socket: " << WSAGetLastError() << std::endl;
+        return false;
+    }
+
+    u_long mode = 1;
+    if (ioctlsocket(sock, FIONBIO, &mode) != 0) {
+        std::cerr << "Failed to set non-blocking mode: " << WSAGetLastError() << std::endl;
+        closesocket(sock);
+        return false;
+    }
+
+    sockaddr_in server_addr;
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_port = htons(port);
+
+    if (inet_pton(AF_INET, host.c_str(), &server_addr.sin_addr) != 1) {
+        std::cerr << "Invalid address: " << host << std::endl;
+        closesocket(sock);
+        return false;
+    }
+
+    // Attempt connection
+    int result = connect(sock, (sockaddr*)&server_addr, sizeof(server_addr));
+    if (result == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSAEWOULDBLOCK) {
+            std::cerr << "Connection failed for " << host << ":" << port
+                      << ", error: " << error << std::endl;
+            closesocket(sock);
+            return false;
+        }
+
+        // Use select to wait for the connection
+        fd_set write_fds;
+        FD_ZERO(&write_fds);
+        FD_SET(sock, &write_fds);
+
+        timeval tv;
+        tv.tv_sec = static_cast<long>(timeout.count() / 1000);
+        tv.tv_usec = static_cast<long>((timeout.count() % 1000) * 1000);
+
+        result = select(0, nullptr, &write_fds, nullptr, &tv);
+        if (result <= 0) {
+            std::cerr << "Select failed or timed out for " << host << ":" << port
+                      << ", error: " << WSAGetLastError() << std::endl;
+            closesocket(sock);
+            return false;
+        }
+    }
+
+    closesocket(sock);
+    return true;
+}
+
+// Sequential on Windows; the concurrent epoll prober is Linux only
+std::vector<bool> TcpProber::probeAll(const std::vector<Endpoint>& endpoints) const {
+    std::vector<bool> results;
+    results.reserve(endpoints.size());
+    for (const auto& endpoint : endpoints) {
+        results.push_back(isServerResponding(endpoint.host, endpoint.port, timeout_));
+    }
+    return results;
+}
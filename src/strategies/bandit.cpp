@@ -0,0 +1,64 @@
+#include "strategies/bandit.hpp"
+#include "utils/random.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static constexpr double kPi = 3.14159265358979323846;
+
+// Standard normal draw (Box-Muller)
+static double standardNormal() {
+    double u1 = fastRandomUnit();
+    double u2 = fastRandomUnit();
+    return std::sqrt(-2.0 * std::log1p(-u1)) * std::cos(2.0 * kPi * u2);
+}
+
+double BanditStrategy::sampleLatencyMs(const Server& server) {
+    auto estimate = server.getLatencyTracker().getEstimate();
+    if (estimate.weight < 1.0) {
+        // Unmeasured (or long idle): optimistic wide draw so it gets tried
+        double mean = estimate.weight > 0.0 ? estimate.mean : 0.0;
+        return std::exp(mean + kPriorStddev * standardNormal() - kPriorStddev);
+    }
+    // Posterior of the mean narrows with the effective sample count
+    double stddev = std::sqrt(estimate.variance / estimate.weight);
+    return std::exp(estimate.mean + stddev * standardNormal());
+}
+
+size_t BanditStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    size_t best_index = npos;
+    double best_cost = std::numeric_limits<double>::max();
+
+    bool sample_all = servers.size() <= kSampleSize;
+    size_t draws = sample_all ? servers.size() : kSampleSize;
+    for (size_t i = 0; i < draws; ++i) {
+        size_t index = sample_all ? i : fastRandomBelow(servers.size());
+        const auto& server = servers[index];
+        if (!server->isHealthy()) continue;
+
+        double cost = sampleLatencyMs(*server) * (server->getActiveConnections() + 1) / server->getRampFactor();
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_index = index;
+        }
+    }
+
+    // Every draw hit an unhealthy server; don't fail while healthy ones exist
+    if (best_index == npos && !sample_all) {
+        size_t offset = fastRandomBelow(servers.size());
+        for (size_t i = 0; i < servers.size(); ++i) {
+            size_t index = (offset + i) % servers.size();
+            if (servers[index]->isHealthy()) {
+                return index;
+            }
+        }
+    }
+    return best_index;
+}
+
+void BanditStrategy::onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) {
+    // The request path only records successful calls
+    if (!success) {
+        server.getLatencyTracker().record(std::max<std::chrono::microseconds>(latency, kFailurePenalty));
+    }
+}
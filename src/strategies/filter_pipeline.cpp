@@ -0,0 +1,185 @@
+#include "strategies/filter_pipeline.hpp"
+#include "utils/numa_topology.hpp"
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <sstream>
+
+namespace {
+
+// splitmix64 finaliser; spreads tenant x server hashes uniformly
+uint64_t mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// out = in & pred(servers); returns false if nothing survives
+template <typename Pred>
+bool applyStage(ServerSpan servers, const std::vector<uint64_t>& in, std::vector<uint64_t>& out, Pred pred) {
+    uint64_t any = 0;
+    for (size_t word = 0; word < in.size(); ++word) {
+        if (in[word] == 0) {
+            out[word] = 0;
+            continue;
+        }
+        size_t base = word * 64;
+        size_t count = std::min<size_t>(64, servers.size() - base);
+        uint64_t bits = 0;
+        for (size_t bit = 0; bit < count; ++bit) {
+            bits |= static_cast<uint64_t>(pred(*servers[base + bit])) << bit;
+        }
+        out[word] = in[word] & bits;
+        any |= out[word];
+    }
+    return any != 0;
+}
+
+// Per-call working buffers. A pipeline's pick strategy may itself be a
+// pipeline (filter=tenant:filter=healthy:p2c), so each nesting level on a
+// thread gets its own set; they stop allocating once they have grown.
+struct Buffers {
+    std::vector<uint64_t> mask;
+    std::vector<uint64_t> scratch;
+    std::vector<std::shared_ptr<Server>> candidates;
+    std::vector<size_t> positions;
+};
+
+class BuffersGuard {
+public:
+    BuffersGuard() {
+        if (depth_ == levels_.size()) {
+            levels_.push_back(std::make_unique<Buffers>());
+        }
+        buffers_ = levels_[depth_++].get();
+    }
+    ~BuffersGuard() {
+        buffers_->candidates.clear();
+        --depth_;
+    }
+    BuffersGuard(const BuffersGuard&) = delete;
+    BuffersGuard& operator=(const BuffersGuard&) = delete;
+
+    Buffers& get() { return *buffers_; }
+
+private:
+    static thread_local std::vector<std::unique_ptr<Buffers>> levels_;
+    static thread_local size_t depth_;
+    Buffers* buffers_;
+};
+
+thread_local std::vector<std::unique_ptr<Buffers>> BuffersGuard::levels_;
+thread_local size_t BuffersGuard::depth_ = 0;
+
+}  // namespace
+
+std::shared_ptr<FilterPipelineStrategy> FilterPipelineStrategy::create(std::shared_ptr<Strategy> pick, const std::string& stages) {
+    std::vector<Stage> parsed;
+    std::stringstream stream(stages.empty() ? "healthy,not_draining" : stages);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (name == "healthy") {
+            parsed.push_back(Stage::Healthy);
+        } else if (name == "not_draining") {
+            parsed.push_back(Stage::NotDraining);
+        } else if (name == "same_node") {
+            parsed.push_back(Stage::SameNode);
+        } else if (name == "has_headroom") {
+            parsed.push_back(Stage::HasHeadroom);
+        } else if (name == "tenant") {
+            parsed.push_back(Stage::Tenant);
+        } else {
+            return nullptr;
+        }
+    }
+    return std::make_shared<FilterPipelineStrategy>(std::move(pick), std::move(parsed));
+}
+
+FilterPipelineStrategy::FilterPipelineStrategy(std::shared_ptr<Strategy> pick, std::vector<Stage> stages)
+    : pick_(std::move(pick))
+    , stages_(std::move(stages)) {}
+
+size_t FilterPipelineStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    if (servers.empty()) {
+        return npos;
+    }
+
+    BuffersGuard guard;
+    auto& mask = guard.get().mask;
+    auto& scratch = guard.get().scratch;
+    size_t words = (servers.size() + 63) / 64;
+    mask.assign(words, ~0ULL);
+    if (servers.size() % 64 != 0) {
+        mask.back() = (1ULL << (servers.size() % 64)) - 1;
+    }
+    scratch.resize(words);
+
+    for (Stage stage : stages_) {
+        bool kept = false;
+        switch (stage) {
+            case Stage::Healthy:
+                kept = applyStage(servers, mask, scratch, [](const Server& s) { return s.isHealthy(); });
+                break;
+            case Stage::NotDraining:
+                kept = applyStage(servers, mask, scratch, [](const Server& s) { return !s.isDraining(); });
+                break;
+            case Stage::HasHeadroom:
+                kept = applyStage(servers, mask, scratch, [](const Server& s) { return !s.getLimiter().isAtLimit(); });
+                break;
+            case Stage::SameNode: {
+                const auto& topology = NumaTopology::getInstance();
+                if (topology.getNodeCount() <= 1) {
+                    continue;
+                }
+                int node = topology.getCurrentNode();
+                kept = applyStage(servers, mask, scratch, [node](const Server& s) { return s.getNumaNode() == node; });
+                break;
+            }
+            case Stage::Tenant: {
+                if (request.tenant().empty()) {
+                    continue;
+                }
+                uint64_t tenant_hash = std::hash<std::string>()(request.tenant());
+                double share = std::min(1.0, kTenantSubsetSize / servers.size());
+                if (share >= 1.0) {
+                    continue;
+                }
+                uint64_t threshold = static_cast<uint64_t>(share * 18446744073709551616.0);
+                kept = applyStage(servers, mask, scratch, [tenant_hash, threshold](const Server& s) {
+                    return mix64(tenant_hash ^ s.getIdHash()) < threshold;
+                });
+                break;
+            }
+        }
+        if (kept) {
+            mask.swap(scratch);
+        }
+    }
+
+    size_t survivors = 0;
+    for (uint64_t word : mask) {
+        survivors += std::bitset<64>(word).count();
+    }
+    if (survivors == servers.size()) {
+        return pick_->selectIndex(servers, request);
+    }
+
+    // Owning copies: pick strategies may keep a server past the call
+    // (prequal hands it to an async probe). The guard drops them on return.
+    auto& candidates = guard.get().candidates;
+    auto& positions = guard.get().positions;
+    candidates.clear();
+    positions.clear();
+    for (size_t i = 0; i < servers.size(); ++i) {
+        if ((mask[i / 64] >> (i % 64)) & 1) {
+            candidates.push_back(servers[i]);
+            positions.push_back(i);
+        }
+    }
+    size_t index = pick_->selectIndex(ServerSpan(candidates), request);
+    return index == npos ? npos : positions[index];
+}
+
+void FilterPipelineStrategy::onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) {
+    pick_->onRequestFinished(server, latency, success);
+}
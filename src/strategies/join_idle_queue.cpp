@@ -0,0 +1,84 @@
+#include "strategies/join_idle_queue.hpp"
+#include "utils/random.hpp"
+
+JoinIdleQueueStrategy::IdleQueue::IdleQueue() {
+    for (size_t i = 0; i < kQueueCapacity; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+        cells_[i].entry = IdleEntry{nullptr, 0};
+    }
+}
+
+bool JoinIdleQueueStrategy::IdleQueue::push(const IdleEntry& entry) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[pos & (kQueueCapacity - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.entry = entry;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // full
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool JoinIdleQueueStrategy::IdleQueue::pop(IdleEntry& entry) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[pos & (kQueueCapacity - 1)];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                entry = cell.entry;
+                cell.sequence.store(pos + kQueueCapacity, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // empty
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+size_t JoinIdleQueueStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    if (servers.empty()) {
+        return npos;
+    }
+
+    size_t worker = currentWorkerIndex() % kMaxWorkers;
+    size_t seen = workers_seen_.load(std::memory_order_relaxed);
+    while (worker >= seen && !workers_seen_.compare_exchange_weak(seen, worker + 1, std::memory_order_relaxed)) {
+    }
+
+    auto& queue = queues_[worker];
+    IdleEntry entry;
+    for (size_t attempt = 0; attempt < kMaxStalePops && queue.pop(entry); ++attempt) {
+        // Found in the span first: only then is the server known to be alive
+        size_t index = indexOf(servers, entry.server, entry.snapshot_index);
+        if (index == npos) {
+            continue;
+        }
+        const Server& idle = *servers[index];
+        if (idle.getActiveConnections() == 0 && idle.isHealthy() && passesRamp(idle)) {
+            return index;
+        }
+    }
+    return pickTwoChoices(servers);
+}
+
+void JoinIdleQueueStrategy::onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) {
+    if (server.getActiveConnections() != 0) {
+        return;
+    }
+    // A full queue just means that worker already has plenty of idle servers
+    queues_[fastRandomBelow(workers_seen_.load(std::memory_order_relaxed))].push(
+        IdleEntry{&server, server.getSnapshotIndex()});
+}
@@ -1,20 +1,21 @@
-#include "strategies/least_connections.hpp"
-
-std::shared_ptr<Server> LeastConnectionsStrategy::selectServer(
-    const std::vector<std::shared_ptr<Server>>& servers,
-    const loadbalancer::Request& request) {
-    std::shared_ptr<Server> best_server = nullptr;
-    int min_connections = INT_MAX;
-
-    for (const auto& server : servers) {
-        if (!server->isHealthy()) continue;
-
-        int active_connections = server->getActiveConnections();
-        if (active_connections < min_connections) {
-            min_connections = active_connections;
-            best_server = server;
-        }
-    }
-
-    return best_server;
-}
\ No newline at end of file
+#include "strategies/least_connections.hpp"
+#include <limits>
+
+size_t LeastConnectionsStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    size_t best_index = npos;
+    double min_score = std::numeric_limits<double>::max();
+
+    for (size_t i = 0; i < servers.size(); ++i) {
+        const auto& server = servers[i];
+        if (!server->isHealthy()) continue;
+
+        // Connections per unit of weight; a ramping server looks busier than it is
+        double score = (server->getActiveConnections() + 1) / server->getRampFactor();
+        if (score < min_score) {
+            min_score = score;
+            best_index = i;
+        }
+    }
+
+    return best_index;
+}
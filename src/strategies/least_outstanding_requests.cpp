@@ -0,0 +1,30 @@
+#include "strategies/least_outstanding_requests.hpp"
+#include "utils/random.hpp"
+#include <limits>
+
+size_t LeastOutstandingRequestsStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    size_t best_index = npos;
+    double min_outstanding = std::numeric_limits<double>::max();
+    size_t ties = 0;
+
+    for (size_t i = 0; i < servers.size(); ++i) {
+        const auto& server = servers[i];
+        if (!server->isHealthy()) continue;
+
+        // Outstanding requests per unit of weight, so slow-starting servers get less
+        double outstanding = (server->getActiveConnections() + 1) / server->getRampFactor();
+        if (outstanding < min_outstanding) {
+            min_outstanding = outstanding;
+            best_index = i;
+            ties = 1;
+        } else if (outstanding == min_outstanding) {
+            // Reservoir sampling: the k-th tied server replaces the pick with probability 1/k
+            ++ties;
+            if (fastRandomBelow(ties) == 0) {
+                best_index = i;
+            }
+        }
+    }
+
+    return best_index;
+}
@@ -0,0 +1,57 @@
+#include "strategies/numa_local.hpp"
+#include "utils/numa_topology.hpp"
+
+NumaLocalStrategy::NumaLocalStrategy(std::shared_ptr<Strategy> inner)
+    : inner_(std::move(inner)) {}
+
+size_t NumaLocalStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    const auto& topology = NumaTopology::getInstance();
+    if (topology.getNodeCount() <= 1) {
+        return inner_->selectIndex(servers, request);
+    }
+
+    int node = topology.getCurrentNode();
+    size_t first = npos;
+    size_t last = 0;
+    size_t count = 0;
+    bool has_headroom = false;
+    for (size_t i = 0; i < servers.size(); ++i) {
+        const auto& server = servers[i];
+        if (server->getNumaNode() != node) continue;
+        if (first == npos) first = i;
+        last = i;
+        count++;
+        if (server->isHealthy() && !server->getLimiter().isAtLimit()) {
+            has_headroom = true;
+        }
+    }
+    if (!has_headroom) {
+        return inner_->selectIndex(servers, request);
+    }
+
+    // ServerManager publishes snapshots grouped by node, so the local servers
+    // are normally one contiguous run the inner strategy can pick from as is
+    if (last - first + 1 == count) {
+        size_t index = inner_->selectIndex(servers.subspan(first, count), request);
+        return index == npos ? npos : first + index;
+    }
+
+    // Arbitrary order: pick from a per-thread copy of the local servers
+    static thread_local std::vector<std::shared_ptr<Server>> local;
+    static thread_local std::vector<size_t> positions;
+    local.clear();
+    positions.clear();
+    for (size_t i = first; i <= last; ++i) {
+        if (servers[i]->getNumaNode() == node) {
+            local.push_back(servers[i]);
+            positions.push_back(i);
+        }
+    }
+    size_t index = inner_->selectIndex(ServerSpan(local), request);
+    local.clear();
+    return index == npos ? npos : positions[index];
+}
+
+void NumaLocalStrategy::onRequestFinished(Server& server, std::chrono::microseconds latency, bool success) {
+    inner_->onRequestFinished(server, latency, success);
+}
@@ -0,0 +1,23 @@
+#include "strategies/per_worker_round_robin.hpp"
+#include "utils/random.hpp"
+
+PerWorkerRoundRobinStrategy::PerWorkerRoundRobinStrategy() {
+    for (auto& cursor : cursors_) {
+        cursor.next.store(fastRandom(), std::memory_order_relaxed);
+    }
+}
+
+size_t PerWorkerRoundRobinStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+
+    if (servers.empty()) {
+        return npos;
+    }
+
+    auto& cursor = cursors_[currentWorkerIndex() % kMaxWorkers];
+    size_t index = cursor.next.fetch_add(1, std::memory_order_relaxed) % servers.size();
+    // Servers in slow start are skipped in proportion to how far they are from full weight
+    for (size_t attempt = 1; attempt < servers.size() && !passesRamp(*servers[index]); ++attempt) {
+        index = cursor.next.fetch_add(1, std::memory_order_relaxed) % servers.size();
+    }
+    return index;
+}
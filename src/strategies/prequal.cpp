@@ -0,0 +1,191 @@
+#include "strategies/prequal.hpp"
+#include "proto/admin_service.grpc.pb.h"
+#include "utils/random.hpp"
+#include <algorithm>
+#include <grpcpp/grpcpp.h>
+
+PrequalStrategy::PrequalStrategy()
+    : pool_(std::make_shared<ProbePool>()) {
+    issue_timer_ = TimerService::getInstance().schedule(kIssueInterval, [this] { issueProbes(); });
+}
+
+PrequalStrategy::~PrequalStrategy() {
+    TimerService::getInstance().cancel(issue_timer_);
+}
+
+void PrequalStrategy::ProbePool::add(const Server* server, size_t snapshot_index, uint32_t in_flight, double latency_ms) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto previous = std::atomic_load(&current);
+    auto next = std::make_shared<ProbeSet>();
+    auto now = std::chrono::steady_clock::now();
+
+    // Carry over the live probes, except an older one from the same server
+    if (previous) {
+        for (size_t i = 0; i < previous->size; ++i) {
+            const Probe& probe = previous->probes[i];
+            if (probe.server == server || now - probe.received > kMaxProbeAge
+                || probe.uses.load(std::memory_order_relaxed) >= kMaxProbeUses) {
+                continue;
+            }
+            Probe& copy = next->probes[next->size++];
+            copy.server = probe.server;
+            copy.snapshot_index = probe.snapshot_index;
+            copy.latency_ms = probe.latency_ms;
+            copy.received = probe.received;
+            copy.in_flight.store(probe.in_flight.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            copy.uses.store(probe.uses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    // The oldest probe makes room once the pool is full
+    size_t slot = next->size;
+    if (slot == kPoolSize) {
+        slot = 0;
+        for (size_t i = 1; i < next->size; ++i) {
+            if (next->probes[i].received < next->probes[slot].received) {
+                slot = i;
+            }
+        }
+    } else {
+        next->size++;
+    }
+    Probe& probe = next->probes[slot];
+    probe.server = server;
+    probe.snapshot_index = snapshot_index;
+    probe.latency_ms = latency_ms;
+    probe.received = now;
+    probe.in_flight.store(in_flight, std::memory_order_relaxed);
+    probe.uses.store(0, std::memory_order_relaxed);
+
+    std::atomic_store(&current, std::shared_ptr<const ProbeSet>(std::move(next)));
+}
+
+void PrequalStrategy::sendProbe(std::shared_ptr<ProbePool> pool, std::shared_ptr<Server> server) {
+    struct ProbeCall {
+        grpc::ClientContext context;
+        google::protobuf::Empty request;
+        admin::ProbeLoadResponse response;
+        std::shared_ptr<ProbePool> pool;
+        std::shared_ptr<Server> server;
+    };
+
+    auto* call = new ProbeCall();
+    call->pool = std::move(pool);
+    call->server = std::move(server);
+    call->context.set_deadline(std::chrono::system_clock::now() + kProbeTimeout);
+    call->server->getAdminStub().async()->ProbeLoad(&call->context, &call->request, &call->response,
+        [call](grpc::Status status) {
+            std::unique_ptr<ProbeCall> owned(call);
+            if (status.ok()) {
+                owned->pool->add(owned->server.get(), owned->server->getSnapshotIndex(),
+                                 owned->response.in_flight(), owned->response.latency_estimate_ms());
+            }
+            owned->pool->outstanding.fetch_sub(1, std::memory_order_relaxed);
+        });
+}
+
+void PrequalStrategy::refreshTargets(ServerSpan servers) {
+    // Whoever is already refreshing will do
+    std::unique_lock<std::mutex> lock(targets_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    auto targets = std::make_shared<const std::vector<std::shared_ptr<Server>>>(servers.begin(), servers.end());
+    std::atomic_store(&targets_, std::move(targets));
+    targets_data_.store(servers.begin(), std::memory_order_relaxed);
+    targets_size_.store(servers.size(), std::memory_order_relaxed);
+}
+
+void PrequalStrategy::issueProbes() {
+    uint64_t requests = requests_.load(std::memory_order_relaxed);
+    // The fractional part of the rate carries over to the next run
+    double budget = (requests - probed_requests_) * kProbesPerRequest + probe_carry_;
+    probed_requests_ = requests;
+    auto count = static_cast<size_t>(budget);
+    probe_carry_ = budget - count;
+
+    auto targets = std::atomic_load(&targets_);
+    if (targets && !targets->empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            if (pool_->outstanding.fetch_add(1, std::memory_order_relaxed) >= kMaxOutstandingProbes) {
+                pool_->outstanding.fetch_sub(1, std::memory_order_relaxed);
+                probe_carry_ = 0.0;
+                break;
+            }
+            sendProbe(pool_, (*targets)[fastRandomBelow(targets->size())]);
+        }
+    }
+    issue_timer_ = TimerService::getInstance().schedule(kIssueInterval, [this] { issueProbes(); });
+}
+
+size_t PrequalStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    if (servers.empty()) {
+        return npos;
+    }
+    uint64_t request_number = requests_.fetch_add(1, std::memory_order_relaxed);
+    if (servers.begin() != targets_data_.load(std::memory_order_relaxed)
+        || servers.size() != targets_size_.load(std::memory_order_relaxed)
+        || request_number % kTargetRefreshRequests == 0) {
+        refreshTargets(servers);
+    }
+
+    auto set = std::atomic_load(&pool_->current);
+    if (!set) {
+        return pickTwoChoices(servers);
+    }
+
+    // Skip probes that are stale, used up, or whose server is no longer routable
+    auto now = std::chrono::steady_clock::now();
+    std::array<size_t, kPoolSize> slots;
+    std::array<size_t, kPoolSize> indices;
+    std::array<uint32_t, kPoolSize> in_flight;
+    size_t kept = 0;
+    for (size_t i = 0; i < set->size; ++i) {
+        const Probe& probe = set->probes[i];
+        if (now - probe.received > kMaxProbeAge || probe.uses.load(std::memory_order_relaxed) >= kMaxProbeUses) {
+            continue;
+        }
+        size_t index = indexOf(servers, probe.server, probe.snapshot_index);
+        if (index == npos || !servers[index]->isHealthy()) {
+            continue;
+        }
+        slots[kept] = i;
+        indices[kept] = index;
+        in_flight[kept] = probe.in_flight.load(std::memory_order_relaxed);
+        kept++;
+    }
+    if (kept == 0) {
+        return pickTwoChoices(servers);
+    }
+
+    std::array<uint32_t, kPoolSize> sorted = in_flight;
+    size_t quantile = static_cast<size_t>(kHotQuantile * (kept - 1));
+    std::nth_element(sorted.begin(), sorted.begin() + quantile, sorted.begin() + kept);
+    uint32_t hot_threshold = sorted[quantile];
+
+    size_t best = npos;
+    bool best_cold = false;
+    for (size_t i = 0; i < kept; ++i) {
+        bool cold = in_flight[i] <= hot_threshold;
+        double latency_ms = set->probes[slots[i]].latency_ms;
+        if (best == npos) {
+            best = i;
+            best_cold = cold;
+        } else if (cold && !best_cold) {
+            best = i;
+            best_cold = true;
+        } else if (cold && best_cold) {
+            if (latency_ms < set->probes[slots[best]].latency_ms) best = i;
+        } else if (!cold && !best_cold) {
+            if (in_flight[i] < in_flight[best]) best = i;
+        }
+    }
+
+    // Account for the request we are about to add. A probe is skipped once
+    // it has been used enough times, and dropped by the next rebuild;
+    // selections racing for its last use may both get it.
+    const Probe& chosen = set->probes[slots[best]];
+    chosen.in_flight.fetch_add(1, std::memory_order_relaxed);
+    chosen.uses.fetch_add(1, std::memory_order_relaxed);
+    return indices[best];
+}
@@ -1,6 +1,23 @@
-#include "strategies/resource_based.hpp"
-
-std::shared_ptr<Server> ResourceBasedStrategy::selectServer(const std::vector<std::shared_ptr<Server>>& servers,
-    const loadbalancer::Request& request){
-    
-}
\ No newline at end of file
+#include "strategies/resource_based.hpp"
+
+size_t ResourceBasedStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request){
+    size_t best_index = npos;
+    double best_cpu = 0.0;
+    double best_memory = 0.0;
+
+    for (size_t i = 0; i < servers.size(); ++i) {
+        const auto& server = servers[i];
+        if (!server->isHealthy()) continue;
+
+        // A fresh server reports idle CPU; treat the missing part of its ramp as load
+        double cpu = server->getCPUUsage() + (1.0 - server->getRampFactor()) * 100.0;
+        double memory = server->getMemoryUsage();
+        if (best_index == npos || cpu < best_cpu || (cpu == best_cpu && memory < best_memory)) {
+            best_index = i;
+            best_cpu = cpu;
+            best_memory = memory;
+        }
+    }
+
+    return best_index;
+}
@@ -1,17 +1,16 @@
-#include "strategies/round_robin.hpp"
-
-std::shared_ptr<Server> RoundRobinStrategy::selectServer(
-    const std::vector<std::shared_ptr<Server>>& servers,
-    const loadbalancer::Request& request) {
-    
-    if (servers.empty()) {
-        return nullptr;
-    }
-
-    size_t index = current_index_++;
-    if (current_index_ >= servers.size()) {
-        current_index_ = 0;
-    }
-
-    return servers[index % servers.size()];
-}
\ No newline at end of file
+#include "strategies/round_robin.hpp"
+
+size_t RoundRobinStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    
+    if (servers.empty()) {
+        return npos;
+    }
+
+    // Never reset the counter: the modulo handles wrap-around and list size changes
+    size_t index = current_index_.fetch_add(1, std::memory_order_relaxed) % servers.size();
+    // Servers in slow start are skipped in proportion to how far they are from full weight
+    for (size_t attempt = 1; attempt < servers.size() && !passesRamp(*servers[index]); ++attempt) {
+        index = current_index_.fetch_add(1, std::memory_order_relaxed) % servers.size();
+    }
+    return index;
+}
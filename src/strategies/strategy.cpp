@@ -0,0 +1,50 @@
+#include "strategies/strategy.hpp"
+
+size_t LegacyStrategy::selectIndex(ServerSpan servers, const loadbalancer::Request& request) {
+    // Reused per thread so legacy strategies don't allocate once it has grown
+    static thread_local std::vector<std::shared_ptr<Server>> legacy;
+    legacy.assign(servers.begin(), servers.end());
+    auto selected = selectServer(legacy, request);
+    legacy.clear();
+
+    for (size_t i = 0; selected && i < servers.size(); ++i) {
+        if (servers[i] == selected) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+size_t Strategy::pickTwoChoices(ServerSpan servers) {
+    if (servers.empty()) {
+        return npos;
+    }
+    if (servers.size() == 1) {
+        return servers[0]->isHealthy() ? 0 : npos;
+    }
+    size_t first = fastRandomBelow(servers.size());
+    size_t second = fastRandomBelow(servers.size() - 1);
+    if (second >= first) {
+        ++second;
+    }
+    const auto& a = servers[first];
+    const auto& b = servers[second];
+    if (!a->isHealthy()) return b->isHealthy() ? second : npos;
+    if (!b->isHealthy()) return first;
+
+    double load_a = (a->getActiveConnections() + 1) / a->getRampFactor();
+    double load_b = (b->getActiveConnections() + 1) / b->getRampFactor();
+    return load_b < load_a ? second : first;
+}
+
+size_t Strategy::indexOf(ServerSpan servers, const Server* server, size_t hint) {
+    if (hint < servers.size() && servers[hint].get() == server) {
+        return hint;
+    }
+    for (size_t i = 0; i < servers.size(); ++i) {
+        if (servers[i].get() == server) {
+            return i;
+        }
+    }
+    return npos;
+}
@@ -0,0 +1,104 @@
+#include "strategies/strategy_registry.hpp"
+#include "strategies/round_robin.hpp"
+#include "strategies/per_worker_round_robin.hpp"
+#include "strategies/least_connections.hpp"
+#include "strategies/least_outstanding_requests.hpp"
+#include "strategies/resource_based.hpp"
+#include "strategies/join_idle_queue.hpp"
+#include "strategies/prequal.hpp"
+#include "strategies/bandit.hpp"
+#include "strategies/power_of_two_choices.hpp"
+#include "strategies/numa_local.hpp"
+#include "strategies/filter_pipeline.hpp"
+
+StrategyRegistry& StrategyRegistry::getInstance() {
+    static StrategyRegistry instance;
+    return instance;
+}
+
+StrategyRegistry::StrategyRegistry() {
+    registerStrategy("round_robin", [] { return std::make_shared<RoundRobinStrategy>(); });
+    registerStrategy("round_robin_per_worker", [] { return std::make_shared<PerWorkerRoundRobinStrategy>(); });
+    registerStrategy("least_connections", [] { return std::make_shared<LeastConnectionsStrategy>(); });
+    registerStrategy("least_outstanding_requests", [] { return std::make_shared<LeastOutstandingRequestsStrategy>(); });
+    registerStrategy("resource_based", [] { return std::make_shared<ResourceBasedStrategy>(); });
+    registerStrategy("join_idle_queue", [] { return std::make_shared<JoinIdleQueueStrategy>(); });
+    registerStrategy("prequal", [] { return std::make_shared<PrequalStrategy>(); });
+    registerStrategy("bandit", [] { return std::make_shared<BanditStrategy>(); });
+    registerStrategy("p2c", [] { return std::make_shared<PowerOfTwoChoicesStrategy>(); });
+
+    registerDecorator("numa_local", [](std::shared_ptr<Strategy> inner, const std::string& args) {
+        return args.empty() ? std::make_shared<NumaLocalStrategy>(std::move(inner)) : nullptr;
+    });
+    registerDecorator("filter", [](std::shared_ptr<Strategy> inner, const std::string& args) {
+        return FilterPipelineStrategy::create(std::move(inner), args);
+    });
+}
+
+void StrategyRegistry::registerStrategy(const std::string& name, Factory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    factories_[name] = std::move(factory);
+}
+
+void StrategyRegistry::registerDecorator(const std::string& name, DecoratorFactory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    decorators_[name] = std::move(factory);
+}
+
+std::shared_ptr<Strategy> StrategyRegistry::create(const std::string& name) const {
+    size_t separator = name.find(':');
+    if (separator != std::string::npos) {
+        std::string decorator_name = name.substr(0, separator);
+        std::string args;
+        size_t equals = decorator_name.find('=');
+        if (equals != std::string::npos) {
+            args = decorator_name.substr(equals + 1);
+            decorator_name.resize(equals);
+        }
+
+        DecoratorFactory decorator;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = decorators_.find(decorator_name);
+            if (it == decorators_.end()) {
+                return nullptr;
+            }
+            decorator = it->second;
+        }
+        auto inner = create(name.substr(separator + 1));
+        return inner ? decorator(std::move(inner), args) : nullptr;
+    }
+
+    Factory factory;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = factories_.find(name);
+        if (it == factories_.end()) {
+            return nullptr;
+        }
+        factory = it->second;
+    }
+    return factory();
+}
+
+bool StrategyRegistry::contains(const std::string& name) const {
+    if (name.find(':') != std::string::npos) {
+        // Decorator arguments can only be validated by building the strategy
+        return create(name) != nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return factories_.find(name) != factories_.end();
+}
+
+std::vector<std::string> StrategyRegistry::getNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (const auto& entry : factories_) {
+        names.push_back(entry.first);
+    }
+    for (const auto& entry : decorators_) {
+        names.push_back(entry.first + ":<strategy>");
+    }
+    return names;
+}
@@ -0,0 +1,161 @@
+#include "utils/cgroup.hpp"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static const char* CGROUP_MOUNT = "/sys/fs/cgroup";
+// Leaf the load balancer moves itself into when its own cgroup must become
+// an inner node (cgroup v2 doesn't allow processes and controlled children
+// side by side)
+static const char* SELF_LEAF = "load_balancer";
+static const int CPU_PERIOD_US = 100000;
+static const int REMOVE_ATTEMPTS = 50;
+static const auto REMOVE_RETRY_INTERVAL = std::chrono::milliseconds(10);
+
+#ifdef __linux__
+// False with errno set if the write failed
+static bool writeFile(const std::string& path, const std::string& value) {
+    int fd = open(path.c_str(), O_WRONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = write(fd, value.data(), value.size()) == static_cast<ssize_t>(value.size());
+    int saved_errno = errno;
+    close(fd);
+    errno = saved_errno;
+    return ok;
+}
+
+static std::string readLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+static bool hasController(const std::string& list, const std::string& controller) {
+    std::string padded = " " + list + " ";
+    return padded.find(" " + controller + " ") != std::string::npos;
+}
+#endif
+
+CgroupTree& CgroupTree::getInstance() {
+    static CgroupTree instance;
+    return instance;
+}
+
+CgroupTree::CgroupTree() {
+#ifdef __linux__
+    if (access((std::string(CGROUP_MOUNT) + "/cgroup.controllers").c_str(), F_OK) != 0) {
+        std::cerr << "cgroup v2 is not mounted; backends will share the load balancer's cgroup" << std::endl;
+        return;
+    }
+
+    // "0::/path" is this process's cgroup in the unified hierarchy
+    std::string own;
+    std::ifstream self("/proc/self/cgroup");
+    for (std::string line; std::getline(self, line);) {
+        if (line.compare(0, 3, "0::") == 0) {
+            own = CGROUP_MOUNT + line.substr(3);
+            break;
+        }
+    }
+    while (own.size() > 1 && own.back() == '/') {
+        own.pop_back();
+    }
+    if (own.empty() || access(own.c_str(), W_OK) != 0) {
+        std::cerr << "cgroup " << (own.empty() ? "(unknown)" : own)
+                  << " is not delegated to us; backends will share the load balancer's cgroup" << std::endl;
+        return;
+    }
+
+    // Controllers are enabled one at a time so a missing one doesn't take
+    // the other down with it
+    std::string subtree_control = own + "/cgroup.subtree_control";
+    std::string available = readLine(own + "/cgroup.controllers");
+    for (const char* controller : {"cpu", "memory"}) {
+        if (!hasController(available, controller)) {
+            continue;
+        }
+        std::string enable = std::string("+") + controller;
+        if (!writeFile(subtree_control, enable) && errno == EBUSY) {
+            std::string self_leaf = own + "/" + SELF_LEAF;
+            if ((mkdir(self_leaf.c_str(), 0755) == 0 || errno == EEXIST)
+                && writeFile(self_leaf + "/cgroup.procs", "0")) {
+                writeFile(subtree_control, enable);
+            }
+        }
+    }
+
+    std::string enabled = readLine(subtree_control);
+    cpu_controller_ = hasController(enabled, "cpu");
+    memory_controller_ = hasController(enabled, "memory");
+    root_ = own;
+    std::cout << "Backends get their own cgroups under " << root_
+              << " (cpu controller " << (cpu_controller_ ? "on" : "off")
+              << ", memory controller " << (memory_controller_ ? "on" : "off") << ")" << std::endl;
+#endif
+}
+
+std::string CgroupTree::createLeaf(const std::string& name, const Limits& limits) {
+#ifdef __linux__
+    if (!isAvailable()) {
+        return "";
+    }
+    std::string path = root_ + "/" + name;
+    if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Could not create cgroup " << path << ": " << std::strerror(errno) << std::endl;
+        return "";
+    }
+
+    if (limits.cpu_cores > 0.0) {
+        long quota = static_cast<long>(limits.cpu_cores * CPU_PERIOD_US);
+        if (!cpu_controller_) {
+            std::cerr << "cpu controller not available, not limiting " << name << std::endl;
+        } else if (!writeFile(path + "/cpu.max", std::to_string(quota) + " " + std::to_string(CPU_PERIOD_US))) {
+            std::cerr << "Could not set cpu.max for " << name << ": " << std::strerror(errno) << std::endl;
+        }
+    }
+    if (limits.memory_mb > 0) {
+        uint64_t bytes = limits.memory_mb * 1024 * 1024;
+        if (!memory_controller_) {
+            std::cerr << "memory controller not available, not limiting " << name << std::endl;
+        } else if (!writeFile(path + "/memory.max", std::to_string(bytes))) {
+            std::cerr << "Could not set memory.max for " << name << ": " << std::strerror(errno) << std::endl;
+        }
+    }
+    return path;
+#else
+    return "";
+#endif
+}
+
+void CgroupTree::removeLeaf(const std::string& path) {
+#ifdef __linux__
+    if (path.empty()) {
+        return;
+    }
+    // cgroup.kill needs Linux 5.14; without it only the backend itself was
+    // signalled and anything it left behind keeps the leaf busy
+    writeFile(path + "/cgroup.kill", "1");
+    for (int attempt = 0; attempt < REMOVE_ATTEMPTS; ++attempt) {
+        if (rmdir(path.c_str()) == 0 || errno == ENOENT) {
+            return;
+        }
+        if (errno != EBUSY) {
+            break;
+        }
+        std::this_thread::sleep_for(REMOVE_RETRY_INTERVAL);
+    }
+    std::cerr << "Could not remove cgroup " << path << ": " << std::strerror(errno) << std::endl;
+#endif
+}
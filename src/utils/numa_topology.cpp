@@ -0,0 +1,100 @@
+#include "utils/numa_topology.hpp"
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+    #include <dirent.h>
+    #include <sched.h>
+#endif
+
+static const char* NODE_DIR = "/sys/devices/system/node";
+
+// Parses sysfs cpu lists such as "0-3,8-11"
+static std::vector<int> parseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) continue;
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+const NumaTopology& NumaTopology::getInstance() {
+    static NumaTopology instance;
+    return instance;
+}
+
+#ifdef __linux__
+// Ids of the online nodes. Falls back to every node<N> entry for kernels
+// without the "online" file.
+static std::vector<int> listNodes() {
+    std::ifstream online(std::string(NODE_DIR) + "/online");
+    std::string list;
+    if (std::getline(online, list) && !list.empty()) {
+        return parseCpuList(list);
+    }
+
+    std::vector<int> nodes;
+    DIR* dir = opendir(NODE_DIR);
+    if (!dir) {
+        return nodes;
+    }
+    while (dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0
+            && name.find_first_not_of("0123456789", 4) == std::string::npos) {
+            nodes.push_back(std::stoi(name.substr(4)));
+        }
+    }
+    closedir(dir);
+    return nodes;
+}
+#endif
+
+NumaTopology::NumaTopology() {
+#ifdef __linux__
+    for (int node : listNodes()) {
+        std::ifstream file(std::string(NODE_DIR) + "/node" + std::to_string(node) + "/cpulist");
+        if (!file) continue;
+        std::string list;
+        std::getline(file, list);
+        if (node >= static_cast<int>(node_cpus_.size())) {
+            node_cpus_.resize(node + 1);
+        }
+        node_cpus_[node] = parseCpuList(list);
+        for (int cpu : node_cpus_[node]) {
+            if (cpu >= static_cast<int>(cpu_to_node_.size())) {
+                cpu_to_node_.resize(cpu + 1, 0);
+            }
+            cpu_to_node_[cpu] = node;
+        }
+    }
+#endif
+    if (node_cpus_.empty()) {
+        node_cpus_.emplace_back();
+    }
+}
+
+int NumaTopology::getNodeOfCpu(int cpu) const {
+    if (cpu < 0 || cpu >= static_cast<int>(cpu_to_node_.size())) {
+        return 0;
+    }
+    return cpu_to_node_[cpu];
+}
+
+int NumaTopology::getCurrentNode() const {
+#ifdef __linux__
+    if (node_cpus_.size() > 1) {
+        return getNodeOfCpu(sched_getcpu());
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "utils/timer_wheel.hpp"
+#include <algorithm>
+
+TimerWheel::TimerWheel(Clock::duration tick, Clock::time_point start)
+    : tick_(tick)
+    , start_(start) {
+    heads_.fill(kNil);
+}
+
+uint64_t TimerWheel::toTick(Clock::time_point t) const {
+    if (t <= start_) {
+        return 0;
+    }
+    return static_cast<uint64_t>((t - start_) / tick_);
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Clock::time_point when, Callback callback) {
+    uint32_t index;
+    if (!free_.empty()) {
+        index = free_.back();
+        free_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+
+    Node& node = nodes_[index];
+    // Round up so a timer never fires early
+    uint64_t expires = toTick(when);
+    if (tickTime(expires) < when) {
+        expires++;
+    }
+    node.expires = std::max(expires, current_tick_);
+    node.callback = std::move(callback);
+    node.generation++;
+    link(index);
+    active_++;
+    return (static_cast<TimerId>(node.generation) << 32) | index;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    uint32_t index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (index >= nodes_.size()) {
+        return false;
+    }
+    Node& node = nodes_[index];
+    if (node.slot == kNil || node.generation != generation) {
+        return false;
+    }
+    unlink(index);
+    release(index);
+    return true;
+}
+
+void TimerWheel::link(uint32_t index) {
+    Node& node = nodes_[index];
+    uint64_t expires = std::max(node.expires, current_tick_);
+    uint64_t delta = expires - current_tick_;
+
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) {
+        level++;
+    }
+    if (level == kLevels - 1) {
+        // Beyond the top level's range: park it at the furthest slot, it is
+        // re-linked (and re-clamped) when that slot cascades
+        uint64_t max_delta = (uint64_t(1) << (kSlotBits * kLevels)) - 1;
+        expires = current_tick_ + std::min(delta, max_delta);
+    }
+
+    uint32_t slot = static_cast<uint32_t>(level * kSlots + ((expires >> (kSlotBits * level)) & kSlotMask));
+    node.slot = slot;
+    node.prev = kNil;
+    node.next = heads_[slot];
+    if (node.next != kNil) {
+        nodes_[node.next].prev = index;
+    }
+    heads_[slot] = index;
+}
+
+void TimerWheel::unlink(uint32_t index) {
+    Node& node = nodes_[index];
+    if (node.prev != kNil) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[node.slot] = node.next;
+    }
+    if (node.next != kNil) {
+        nodes_[node.next].prev = node.prev;
+    }
+    node.prev = kNil;
+    node.next = kNil;
+    node.slot = kNil;
+}
+
+void TimerWheel::release(uint32_t index) {
+    nodes_[index].callback = nullptr;
+    free_.push_back(index);
+    active_--;
+}
+
+void TimerWheel::cascade(int level, uint32_t slot) {
+    uint32_t index = heads_[level * kSlots + slot];
+    heads_[level * kSlots + slot] = kNil;
+    while (index != kNil) {
+        uint32_t next = nodes_[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+void TimerWheel::advance(Clock::time_point now, std::vector<std::pair<TimerId, Callback>>& expired) {
+    uint64_t target = toTick(now);
+    if (active_ == 0) {
+        // Nothing to fire or cascade; skip straight to now
+        current_tick_ = std::max(current_tick_, target + 1);
+        return;
+    }
+
+    while (current_tick_ <= target && active_ > 0) {
+        uint32_t slot = static_cast<uint32_t>(current_tick_ & kSlotMask);
+        if (slot == 0) {
+            // Entering a new level-0 revolution: pull the matching slots of
+            // the higher levels down, outermost first
+            for (int level = 1; level < kLevels; ++level) {
+                uint32_t upper = static_cast<uint32_t>((current_tick_ >> (kSlotBits * level)) & kSlotMask);
+                cascade(level, upper);
+                if (upper != 0) {
+                    break;
+                }
+            }
+        }
+
+        uint32_t index = heads_[slot];
+        while (index != kNil) {
+            uint32_t next = nodes_[index].next;
+            Node& node = nodes_[index];
+            unlink(index);
+            expired.emplace_back((static_cast<TimerId>(node.generation) << 32) | index, std::move(node.callback));
+            release(index);
+            index = next;
+        }
+        current_tick_++;
+    }
+    if (active_ == 0) {
+        current_tick_ = std::max(current_tick_, target + 1);
+    }
+}
+
+TimerWheel::Clock::time_point TimerWheel::nextWakeup() const {
+    if (active_ == 0) {
+        return Clock::time_point::max();
+    }
+    uint64_t first = current_tick_ & kSlotMask;
+    for (uint64_t slot = first; slot < kSlots; ++slot) {
+        if (heads_[slot] != kNil) {
+            return tickTime(current_tick_ + (slot - first));
+        }
+    }
+    // Level 0 is empty for the rest of this revolution; the next cascade
+    // may bring something down
+    return tickTime((current_tick_ | kSlotMask) + 1);
+}
+
+TimerService& TimerService::getInstance() {
+    static TimerService* instance = new TimerService();
+    return *instance;
+}
+
+TimerService::TimerService(std::chrono::milliseconds tick)
+    : wheel_(tick, TimerWheel::Clock::now())
+    , planned_wakeup_(TimerWheel::Clock::time_point::max())
+    , thread_(&TimerService::run, this) {}
+
+TimerService::~TimerService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+TimerService::TimerId TimerService::schedule(std::chrono::steady_clock::duration delay, Callback callback) {
+    auto when = TimerWheel::Clock::now() + delay;
+    std::lock_guard<std::mutex> lock(mutex_);
+    TimerId id = wheel_.schedule(when, std::move(callback));
+    if (when < planned_wakeup_) {
+        wake_.notify_one();
+    }
+    return id;
+}
+
+bool TimerService::cancel(TimerId id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wheel_.cancel(id)) {
+        return true;
+    }
+    for (size_t i = next_expired_; i < expired_.size(); ++i) {
+        if (expired_[i].first == id) {
+            expired_[i].second = nullptr;
+            return true;
+        }
+    }
+    if (std::this_thread::get_id() != thread_.get_id()) {
+        callback_done_.wait(lock, [this, id] { return running_id_ != id; });
+    }
+    return false;
+}
+
+void TimerService::cancel(std::atomic<TimerId>& timer) {
+    TimerId id = timer.load();
+    while (id != 0) {
+        cancel(id);
+        // A callback that was running may have scheduled its next run
+        TimerId next = timer.load();
+        if (next == id) {
+            break;
+        }
+        id = next;
+    }
+}
+
+size_t TimerService::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return wheel_.size();
+}
+
+void TimerService::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        planned_wakeup_ = wheel_.nextWakeup();
+        if (planned_wakeup_ == TimerWheel::Clock::time_point::max()) {
+            wake_.wait(lock);
+        } else {
+            wake_.wait_until(lock, planned_wakeup_);
+        }
+        planned_wakeup_ = TimerWheel::Clock::time_point::min();
+        if (stopping_) {
+            break;
+        }
+
+        wheel_.advance(TimerWheel::Clock::now(), expired_);
+        for (next_expired_ = 0; next_expired_ < expired_.size();) {
+            auto& timer = expired_[next_expired_++];
+            if (!timer.second) {
+                continue;  // cancelled after it expired
+            }
+            running_id_ = timer.first;
+            auto callback = std::move(timer.second);
+            lock.unlock();
+            callback();
+            callback = nullptr;
+            lock.lock();
+            running_id_ = 0;
+            callback_done_.notify_all();
+        }
+        expired_.clear();
+        next_expired_ = 0;
+    }
+}